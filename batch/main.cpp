@@ -0,0 +1,310 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      main.cpp
+///
+/// \brief     Headless runner of many ROMs in parallel, results printed as JSON lines.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "console.h"
+#include "hash.h"
+#include "manifest.h"
+#include "metricsexporter.h"
+#include "opcodeprofile.h"
+#include "workstealingpool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+
+namespace
+{
+/// \brief Outcome of a job.
+struct JobResult
+{
+    const char* status = "ok";   ///< "ok" or "error".
+    const char* stop = "";       ///< What stopped the job, or the error.
+    uint64_t frames = 0;         ///< Emulated frames.
+    uint64_t clocks = 0;         ///< Emulated master clocks.
+    double wallMs = 0.0;         ///< Wall time of the job.
+    uint64_t stateHash = 0;      ///< Hash of the console's final state.
+};
+
+/// \brief Serializes the output lines.
+std::mutex outputMutex;
+
+/// \brief Escape a string for a JSON string literal.
+std::string escapeJSON(const std::string& text)
+{
+    std::string escaped;
+    for (const char character : text)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            escaped += '\\';
+        }
+        escaped += ((character >= 0) && (character < 0x20)) ? ' ' : character;
+    }
+
+    return escaped;
+}
+
+/// \brief Run a job until its first termination condition.
+///
+/// \param jobIdx job's index in the manifest.
+/// \param job the job.
+/// \param metricsExporter exports the console's metrics while it runs, may be nullptr.
+JobResult runJob(const uint32_t jobIdx, const BatchJob& job, MetricsExporter* metricsExporter)
+{
+    JobResult result;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    auto console = std::make_unique<Console>(job.type, job.romPath);
+    if (console->isCartridgeValid() == false)
+    {
+        result.status = "error";
+        result.stop = "cannot read the ROM";
+        return result;
+    }
+
+    // Nobody listens to a batch run.
+    console->setAudioMode(ApuMode::eAPUMODE_statusonly);
+    console->powerOn((job.fastStart == true) ? BootMode::eBOOTMODE_fastStart
+                                             : BootMode::eBOOTMODE_bootROM);
+
+    if ((job.tracePath.empty() == false) && (console->startTrace(job.tracePath) == false))
+    {
+        result.status = "error";
+        result.stop = "cannot create the trace";
+        return result;
+    }
+
+    if (metricsExporter != nullptr)
+    {
+        metricsExporter->addConsole("job" + std::to_string(jobIdx), console->getMetrics());
+    }
+
+    // About 1000 samples per emulated second.
+    if (job.profilePath.empty() == false)
+    {
+        console->startProfiling(4096);
+    }
+
+    const uint64_t framesBudget = (job.framesBudget == 0) ? UINT64_MAX : job.framesBudget;
+    const uint64_t clocksBudget = (job.clocksBudget == 0) ? UINT64_MAX : job.clocksBudget;
+    // Longest frame run so far, from the 154 lines of 456 clocks of the LCD.
+    uint64_t frameClocks = 70224;
+    while (true)
+    {
+        if (result.frames >= framesBudget)
+        {
+            result.stop = "frames";
+            break;
+        }
+
+        // A frame that may not fit in the clocks budget is replaced by the cycles left in it. Only
+        // a first frame longer than the estimate may cross the budget.
+        const uint64_t clock = console->getClock();
+        if (clock >= clocksBudget)
+        {
+            result.stop = "clocks";
+            break;
+        }
+        if (clocksBudget - clock < frameClocks)
+        {
+            result.stop = (console->runCycles((clocksBudget - clock) / 4) == true) ? "clocks"
+                                                                                  : "poweroff";
+            break;
+        }
+
+        if (console->runFrame() == false)
+        {
+            result.stop = "poweroff";
+            break;
+        }
+        ++result.frames;
+        frameClocks = std::max(frameClocks, console->getClock() - clock);
+
+        if ((job.stopOnMemory == true) &&
+            (console->readMemory(job.stopAddress) == job.stopValue))
+        {
+            result.stop = "memory";
+            break;
+        }
+    }
+
+    result.clocks = console->getClock();
+
+    if (metricsExporter != nullptr)
+    {
+        metricsExporter->removeConsole(console->getMetrics());
+    }
+
+    if ((job.profilePath.empty() == false) &&
+        (console->getProfiler()->writeFoldedStacks(job.profilePath) == false))
+    {
+        result.status = "error";
+        result.stop = "cannot write the profile";
+    }
+
+    if (console->stopTrace() == false)
+    {
+        result.status = "error";
+        result.stop = "cannot write the trace";
+    }
+
+    std::vector<uint8_t> state(console->getStateSize());
+    const size_t stateSize = console->saveState(state.data(), state.size());
+    result.stateHash = cbutil::hashXXH64(state.data(), stateSize);
+
+    const auto end = std::chrono::steady_clock::now();
+    result.wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    return result;
+}
+
+/// \brief Print the result of a job as a JSON line.
+void printResult(const uint32_t jobIdx, const BatchJob& job, const JobResult& result)
+{
+    // The master clock runs at 4.194304 MHz.
+    const double emulatedMHz = (result.wallMs > 0.0) ? result.clocks / (result.wallMs * 1e3) : 0.0;
+
+    std::lock_guard<std::mutex> lock(outputMutex);
+    std::printf("{\"job\":%u,\"rom\":\"%s\",\"type\":\"%s\",\"status\":\"%s\",\"stop\":\"%s\","
+                "\"frames\":%" PRIu64 ",\"clocks\":%" PRIu64 ",\"wall_ms\":%.3f,"
+                "\"emulated_mhz\":%.3f,\"speed\":%.2f,\"state_hash\":\"%016" PRIx64 "\"}\n",
+                jobIdx,
+                escapeJSON(job.romPath.string()).c_str(),
+                (job.type == GBType::eGBTYPE_cgb) ? "cgb" : "dmg",
+                result.status,
+                result.stop,
+                result.frames,
+                result.clocks,
+                result.wallMs,
+                emulatedMHz,
+                emulatedMHz / 4.194304,
+                result.stateHash);
+    std::fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::filesystem::path manifestPath;
+    uint32_t threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    std::filesystem::path metricsPath;
+    MetricsFormat metricsFormat = MetricsFormat::eMETRICSFORMAT_prometheus;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string arg = argv[argIdx];
+        // --threads N: size of the pool, the host's cores by default.
+        if ((arg == "--threads") && (argIdx + 1 < argc))
+        {
+            threadsCount = std::max(std::atoi(argv[++argIdx]), 1);
+        }
+        // --metrics FILE: the running jobs' metrics, exported every second (Prometheus text).
+        // --metrics-mmap FILE: same in a memory mapped file, see sharedmetrics.h.
+        else if (((arg == "--metrics") || (arg == "--metrics-mmap")) && (argIdx + 1 < argc))
+        {
+            metricsPath = argv[++argIdx];
+            metricsFormat = (arg == "--metrics") ? MetricsFormat::eMETRICSFORMAT_prometheus :
+                                                   MetricsFormat::eMETRICSFORMAT_mmap;
+        }
+        else
+        {
+            manifestPath = arg;
+        }
+    }
+
+    if (manifestPath.empty() == true)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s MANIFEST [--threads N] [--metrics FILE | --metrics-mmap FILE]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    std::vector<BatchJob> jobs;
+    std::string error;
+    if (parseManifest(manifestPath, jobs, error) == false)
+    {
+        std::fprintf(stderr, "%s: %s\n", manifestPath.string().c_str(), error.c_str());
+        return 1;
+    }
+
+    std::unique_ptr<MetricsExporter> metricsExporter;
+    if (metricsPath.empty() == false)
+    {
+        metricsExporter = std::make_unique<MetricsExporter>();
+        if (metricsExporter->start(metricsPath, metricsFormat, std::chrono::seconds(1)) == false)
+        {
+            std::fprintf(stderr, "Cannot create the metrics file '%s'\n", metricsPath.c_str());
+            return 1;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<JobResult> results(jobs.size());
+    {
+        WorkStealingPool pool(threadsCount);
+        for (uint32_t jobIdx = 0; jobIdx < jobs.size(); ++jobIdx)
+        {
+            pool.submit([&, jobIdx]() {
+                results[jobIdx] = runJob(jobIdx, jobs[jobIdx], metricsExporter.get());
+                printResult(jobIdx, jobs[jobIdx], results[jobIdx]);
+            });
+        }
+        pool.wait();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const double wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    uint64_t totalClocks = 0;
+    uint32_t failedJobs = 0;
+    for (const JobResult& result : results)
+    {
+        totalClocks += result.clocks;
+        failedJobs += (result.status[0] == 'e') ? 1 : 0;
+    }
+
+    std::printf("{\"summary\":true,\"jobs\":%zu,\"failed\":%u,\"threads\":%u,\"wall_ms\":%.3f,"
+                "\"emulated_mhz\":%.3f}\n",
+                jobs.size(),
+                failedJobs,
+                threadsCount,
+                wallMs,
+                (wallMs > 0.0) ? totalClocks / (wallMs * 1e3) : 0.0);
+
+#ifdef COLORBOY_OPCODE_PROFILE
+    // The workers are joined: their counters are all merged. stdout only holds JSON lines.
+    OpcodeProfile::dump(stderr);
+#endif
+
+    return (failedJobs == 0) ? 0 : 1;
+}
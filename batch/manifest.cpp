@@ -0,0 +1,200 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      manifest.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "manifest.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+/// \brief Parse an unsigned integer, decimal or hexadecimal with a 0x prefix.
+///
+/// \return true if the whole text is a number not above maxValue, false otherwise.
+bool parseNumber(const std::string& text, const uint64_t maxValue, uint64_t& value)
+{
+    if (text.empty() == true)
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoull(text.c_str(), &end, 0);
+
+    return (*end == '\0') && (errno == 0) && (text[0] != '-') && (value <= maxValue);
+}
+
+/// \brief Apply a key=value option to a job.
+///
+/// \return true if the option is valid, false otherwise.
+bool parseOption(const std::string& option, BatchJob& job)
+{
+    const size_t equalPos = option.find('=');
+    if (equalPos == std::string::npos)
+    {
+        return false;
+    }
+
+    const std::string key = option.substr(0, equalPos);
+    const std::string value = option.substr(equalPos + 1);
+    uint64_t number = 0;
+
+    if (key == "type")
+    {
+        if ((value != "dmg") && (value != "cgb"))
+        {
+            return false;
+        }
+        job.type = (value == "cgb") ? GBType::eGBTYPE_cgb : GBType::eGBTYPE_dmg;
+    }
+    else if (key == "boot")
+    {
+        if ((value != "rom") && (value != "fast"))
+        {
+            return false;
+        }
+        job.fastStart = (value == "fast");
+    }
+    else if (key == "frames")
+    {
+        if ((parseNumber(value, UINT64_MAX, number) == false) || (number == 0))
+        {
+            return false;
+        }
+        job.framesBudget = number;
+    }
+    else if (key == "clocks")
+    {
+        if ((parseNumber(value, UINT64_MAX, number) == false) || (number == 0))
+        {
+            return false;
+        }
+        job.clocksBudget = number;
+    }
+    else if (key == "until")
+    {
+        const size_t colonPos = value.find(':');
+        uint64_t address = 0;
+        if ((colonPos == std::string::npos) ||
+            (parseNumber(value.substr(0, colonPos), UINT16_MAX, address) == false) ||
+            (parseNumber(value.substr(colonPos + 1), UINT8_MAX, number) == false))
+        {
+            return false;
+        }
+        job.stopOnMemory = true;
+        job.stopAddress = static_cast<uint16_t>(address);
+        job.stopValue = static_cast<uint8_t>(number);
+    }
+    else if (key == "profile")
+    {
+        if (value.empty() == true)
+        {
+            return false;
+        }
+        job.profilePath = value;
+    }
+    else if (key == "trace")
+    {
+        if (value.empty() == true)
+        {
+            return false;
+        }
+        job.tracePath = value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace
+
+// =================================================================================================
+
+bool parseManifest(const std::filesystem::path& path,
+                   std::vector<BatchJob>& jobs,
+                   std::string& error)
+{
+    std::ifstream manifest(path);
+    if (manifest.is_open() == false)
+    {
+        error = "cannot open the manifest";
+        return false;
+    }
+
+    const std::filesystem::path manifestDir = path.parent_path();
+
+    std::string line;
+    uint32_t lineNumber = 0;
+    while (std::getline(manifest, line))
+    {
+        ++lineNumber;
+
+        std::istringstream words(line);
+        std::string romPath;
+        if (!(words >> romPath) || (romPath[0] == '#'))
+        {
+            continue;
+        }
+
+        BatchJob job;
+        job.romPath = manifestDir / romPath;
+
+        std::string option;
+        while (words >> option)
+        {
+            if (parseOption(option, job) == false)
+            {
+                error = "line " + std::to_string(lineNumber) + ": invalid option '" + option + "'";
+                return false;
+            }
+        }
+
+        if (job.profilePath.empty() == false)
+        {
+            job.profilePath = manifestDir / job.profilePath;
+        }
+        if (job.tracePath.empty() == false)
+        {
+            job.tracePath = manifestDir / job.tracePath;
+        }
+
+        if ((job.framesBudget == 0) && (job.clocksBudget == 0))
+        {
+            error = "line " + std::to_string(lineNumber) + ": no frames or clocks budget";
+            return false;
+        }
+
+        jobs.push_back(job);
+    }
+
+    return true;
+}
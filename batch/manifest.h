@@ -0,0 +1,84 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      manifest.h
+///
+/// \brief     Jobs of a batch run, read from a manifest file.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef MANIFEST_H_
+#define MANIFEST_H_
+
+#include "config.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// =================================================================================================
+//   Manifest file:
+//
+// One job per line: the ROM path, relative to the manifest, followed by key=value options.
+// Empty lines and lines starting with '#' are ignored.
+//
+//   # ROM                      options
+//   roms/cpu_instrs.gb         frames=3600
+//   roms/game.gbc              type=cgb clocks=419430400 until=0xC000:0x42
+//
+// type=dmg|cgb           Game Boy type, dmg by default.
+// boot=rom|fast          Run the boot ROM (default) or start in its post-boot state.
+// frames=N               Stop after N frames.
+// clocks=N               Stop after N master clocks (4.194304 MHz).
+// until=ADDRESS:VALUE    Stop when the byte at ADDRESS reads VALUE at the end of a frame.
+// profile=PATH           Sample the code run by the ROM, written as folded stacks to PATH.
+// trace=PATH             Record every instruction into the binary CPU trace PATH.
+//
+// A job needs a frames or a clocks budget, the first budget reached stops it.
+// =================================================================================================
+
+/// \brief A ROM to run and when to stop it.
+struct BatchJob
+{
+    std::filesystem::path romPath;       ///< Path of the ROM.
+    GBType type = GBType::eGBTYPE_dmg;   ///< Emulated Game Boy's type.
+    bool fastStart = false;              ///< Is the boot ROM skipped?
+    uint64_t framesBudget = 0;           ///< Frames to run, 0 for no limit.
+    uint64_t clocksBudget = 0;           ///< Master clocks to run, 0 for no limit.
+    bool stopOnMemory = false;           ///< Is there a memory stop condition?
+    uint16_t stopAddress = 0;            ///< Address of the byte checked after each frame.
+    uint8_t stopValue = 0;               ///< Value of the byte that stops the job.
+    std::filesystem::path profilePath;   ///< Folded stacks of the job's samples, empty for none.
+    std::filesystem::path tracePath;     ///< CPU trace of the job, empty for none.
+};
+
+/// \brief Read the jobs of a manifest file.
+///
+/// \param path manifest file path.
+/// \param[out] jobs receives the jobs.
+/// \param[out] error receives the description of the first invalid line.
+///
+/// \return true if the whole manifest is valid, false otherwise.
+bool parseManifest(const std::filesystem::path& path,
+                   std::vector<BatchJob>& jobs,
+                   std::string& error);
+
+#endif /* MANIFEST_H_ */
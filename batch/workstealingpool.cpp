@@ -0,0 +1,148 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      workstealingpool.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "workstealingpool.h"
+
+WorkStealingPool::WorkStealingPool(const uint32_t threadsCount)
+{
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx)
+    {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (uint32_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx)
+    {
+        m_threads.emplace_back(&WorkStealingPool::workerLoop, this, threadIdx);
+    }
+}
+
+// =================================================================================================
+
+WorkStealingPool::~WorkStealingPool()
+{
+    wait();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+// =================================================================================================
+
+void WorkStealingPool::submit(Task task)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    WorkerQueue& queue = *m_queues[m_nextQueue];
+    m_nextQueue = (m_nextQueue + 1) % m_queues.size();
+    {
+        std::lock_guard<std::mutex> queueLock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    ++m_queuedTasks;
+    ++m_pendingTasks;
+    m_wakeUp.notify_one();
+}
+
+// =================================================================================================
+
+void WorkStealingPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this]() { return m_pendingTasks == 0; });
+}
+
+// =================================================================================================
+
+void WorkStealingPool::workerLoop(const uint32_t workerIdx)
+{
+    Task task;
+    while (true)
+    {
+        if (takeTask(workerIdx, task) == true)
+        {
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pendingTasks == 0)
+            {
+                m_finished.notify_all();
+            }
+            continue;
+        }
+
+        // The tasks are queued under the mutex: none can be missed between the check and the wait.
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeUp.wait(lock, [this]() { return (m_queuedTasks > 0) || (m_stop == true); });
+        if ((m_stop == true) && (m_queuedTasks == 0))
+        {
+            return;
+        }
+    }
+}
+
+// =================================================================================================
+
+bool WorkStealingPool::takeTask(const uint32_t workerIdx, Task& task)
+{
+    const uint32_t queuesCount = static_cast<uint32_t>(m_queues.size());
+    for (uint32_t offset = 0; offset < queuesCount; ++offset)
+    {
+        WorkerQueue& queue = *m_queues[(workerIdx + offset) % queuesCount];
+
+        std::lock_guard<std::mutex> queueLock(queue.mutex);
+        if (queue.tasks.empty() == true)
+        {
+            continue;
+        }
+
+        // The worker's own tasks are taken from the back, the stolen ones from the front.
+        if (offset == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        --m_queuedTasks;
+
+        return true;
+    }
+
+    return false;
+}
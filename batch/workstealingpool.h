@@ -0,0 +1,96 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      workstealingpool.h
+///
+/// \brief     Pool of threads running independent tasks, idle threads steal queued tasks.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef WORKSTEALINGPOOL_H_
+#define WORKSTEALINGPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Pool of worker threads, each with its own queue of tasks.
+///
+/// A worker runs the newest task of its own queue and, once it is empty, steals the oldest task
+/// of another worker: tasks of very different lengths keep every thread busy.
+class WorkStealingPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// \brief Constructor.
+    ///
+    /// \param threadsCount number of worker threads.
+    explicit WorkStealingPool(const uint32_t threadsCount);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /// \brief Queue a task, the queues are filled in turn.
+    void submit(Task task);
+
+    /// \brief Wait for all the submitted tasks to finish.
+    void wait();
+
+    /// \brief Get the number of worker threads.
+    uint32_t getThreadsCount() const { return static_cast<uint32_t>(m_threads.size()); }
+
+private:
+    /// \brief Queue of a worker.
+    struct WorkerQueue
+    {
+        std::mutex mutex;       ///< Protects the tasks.
+        std::deque<Task> tasks;  ///< Queued tasks, the newest at the back.
+    };
+
+    /// \brief Main loop of the worker threads.
+    void workerLoop(const uint32_t workerIdx);
+
+    /// \brief Take the newest task of the worker's queue, or steal the oldest of another queue.
+    ///
+    /// \return true if a task was taken, false if every queue is empty.
+    bool takeTask(const uint32_t workerIdx, Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;  ///< Queue of each worker.
+    std::vector<std::thread> m_threads;                  ///< Worker threads.
+
+    std::mutex m_mutex;                  ///< Protects the counters used to sleep and wake up.
+    std::condition_variable m_wakeUp;    ///< Signals queued tasks to the idle workers.
+    std::condition_variable m_finished;  ///< Signals the end of the last task.
+    std::atomic<uint32_t> m_queuedTasks{0};  ///< Tasks waiting in the queues.
+    uint32_t m_pendingTasks = 0;             ///< Tasks submitted and not finished yet.
+    uint32_t m_nextQueue = 0;                ///< Queue receiving the next task.
+    bool m_stop = false;                     ///< Are the workers asked to exit?
+};
+
+#endif /* WORKSTEALINGPOOL_H_ */
@@ -0,0 +1,104 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      apubench.cpp
+///
+/// \brief     CPU cost of the APU per emulated second.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "apu.h"
+
+#include <array>
+
+namespace
+{
+/// \brief Play a note on each of the 4 channels.
+void playChord(Mmu& mmu)
+{
+    const std::array<std::pair<uint16_t, uint8_t>, 19> writes = {{
+        {HardwareIORegisters::eIOREG_nr52, 0x80},  // Power on.
+        {HardwareIORegisters::eIOREG_nr50, 0x77},
+        {HardwareIORegisters::eIOREG_nr51, 0xFF},
+        {HardwareIORegisters::eIOREG_nr10, 0x00},  // Channel 1: 440 Hz, 50% duty.
+        {HardwareIORegisters::eIOREG_nr11, 0x80},
+        {HardwareIORegisters::eIOREG_nr12, 0xF0},
+        {HardwareIORegisters::eIOREG_nr13, 0xD6},
+        {HardwareIORegisters::eIOREG_nr14, 0x86},
+        {HardwareIORegisters::eIOREG_nr21, 0x40},  // Channel 2: 554 Hz, 25% duty, fading.
+        {HardwareIORegisters::eIOREG_nr22, 0xF7},
+        {HardwareIORegisters::eIOREG_nr23, 0x21},
+        {HardwareIORegisters::eIOREG_nr24, 0x87},
+        {HardwareIORegisters::eIOREG_nr30, 0x80},  // Channel 3: ramp at 327 Hz.
+        {HardwareIORegisters::eIOREG_nr32, 0x20},
+        {HardwareIORegisters::eIOREG_nr33, 0x00},
+        {HardwareIORegisters::eIOREG_nr34, 0x87},
+        {HardwareIORegisters::eIOREG_nr42, 0xF0},  // Channel 4: noise.
+        {HardwareIORegisters::eIOREG_nr43, 0x55},
+        {HardwareIORegisters::eIOREG_nr44, 0x80},
+    }};
+
+    for (uint8_t sample = 0; sample < 16; ++sample)
+    {
+        mmu.writeByte((sample * 2) << 4 | ((sample * 2) + 1),
+                      HardwareIORegisters::eIOREG_wavestart + sample);
+    }
+    for (const auto& [address, byte] : writes)
+    {
+        mmu.writeByte(byte, address);
+    }
+}
+
+}  // namespace
+
+CBBENCH(apu)
+{
+    const std::pair<ApuMode, const char*> modes[] = {
+        {ApuMode::eAPUMODE_synthesis, "synthesis"}, {ApuMode::eAPUMODE_statusonly, "statusonly"}};
+
+    for (const auto& [mode, modeName] : modes)
+    {
+        Mmu mmu;
+        Scheduler scheduler;
+        Apu apu(mmu, scheduler);
+        apu.setMode(mode);
+        playChord(mmu);
+
+        // An audio thread would drain the samples, this one just throws them away.
+        std::array<int16_t, 2048> samples;
+
+        runner.measure(std::string("apu/") + modeName, 1, Apu::eClockRate, "clock", [&]() {
+            // Advance one scanline (456 clocks) at a time so that the loop itself costs nothing.
+            for (uint32_t line = 0; line < Apu::eClockRate / 456; ++line)
+            {
+                scheduler.advance(456);
+                if ((line % 64) == 0)
+                {
+                    while (apu.getOutput().pop(samples.data(), samples.size() / 2) > 0)
+                    {
+                    }
+                }
+            }
+        });
+    }
+}
@@ -0,0 +1,165 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      bench.h
+///
+/// \brief     Minimal benchmark harness of the colorboy-bench target.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+/// \brief Runs the measurements and prints one JSON object per benchmark.
+class Runner
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param filter only the benchmarks whose name contains this string are run.
+    /// \param samples number of timed samples per benchmark.
+    /// \param romsDirectory directory searched for the ROMs run by the macro benchmarks.
+    Runner(std::string filter, const uint32_t samples, std::string romsDirectory) :
+        m_filter(std::move(filter)), m_samples(samples), m_romsDirectory(std::move(romsDirectory))
+    {
+    }
+
+    /// \brief Time a function.
+    ///
+    /// \param name benchmark's name.
+    /// \param iterations calls of the function per sample.
+    /// \param workPerIteration amount of work done by one call (e.g. pixels, cycles).
+    /// \param workUnit unit of the work, the throughput is reported in millions of it per second.
+    /// \param function the function to time.
+    void measure(const std::string& name,
+                 const uint32_t iterations,
+                 const double workPerIteration,
+                 const char* workUnit,
+                 const std::function<void()>& function)
+    {
+        if (isSelected(name) == false)
+        {
+            return;
+        }
+
+        // Warm up the caches and the branch predictors.
+        function();
+
+        std::vector<double> samplesNs(m_samples);
+        for (double& sampleNs : samplesNs)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t iter = 0; iter < iterations; ++iter)
+            {
+                function();
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            sampleNs = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+        }
+
+        report(name, samplesNs, workPerIteration, workUnit);
+    }
+
+    /// \brief Report samples timed by the benchmark itself.
+    ///
+    /// \param name benchmark's name.
+    /// \param samplesNs duration of each sample in nanoseconds.
+    /// \param workPerSample amount of work done by one sample.
+    /// \param workUnit unit of the work, the throughput is reported in millions of it per second.
+    void report(const std::string& name,
+                std::vector<double> samplesNs,
+                const double workPerSample,
+                const char* workUnit)
+    {
+        std::sort(samplesNs.begin(), samplesNs.end());
+
+        const double minNs = samplesNs.front();
+        const double medianNs = samplesNs[samplesNs.size() / 2];
+        const double p99Ns = samplesNs[std::min(samplesNs.size() - 1,
+                                                (samplesNs.size() * 99) / 100)];
+
+        std::printf("{\"benchmark\":\"%s\",\"samples\":%zu,\"min_ns\":%.1f,\"median_ns\":%.1f,"
+                    "\"p99_ns\":%.1f,\"throughput\":%.3f,\"unit\":\"M%s/s\"}\n",
+                    name.c_str(),
+                    samplesNs.size(),
+                    minNs,
+                    medianNs,
+                    p99Ns,
+                    (workPerSample * 1e3) / medianNs,
+                    workUnit);
+        std::fflush(stdout);
+    }
+
+    /// \brief Check if a benchmark is selected by the filter.
+    bool isSelected(const std::string& name) const
+    {
+        return name.find(m_filter) != std::string::npos;
+    }
+
+    /// \brief Get the number of timed samples per benchmark.
+    uint32_t getSamplesCount() const { return m_samples; }
+
+    /// \brief Get the directory searched for the ROMs run by the macro benchmarks.
+    const std::string& getROMsDirectory() const { return m_romsDirectory; }
+
+private:
+    std::string m_filter;         ///< Benchmarks' names filter.
+    uint32_t m_samples;           ///< Timed samples per benchmark.
+    std::string m_romsDirectory;  ///< ROMs of the macro benchmarks.
+};
+
+using BenchFunction = void (*)(Runner&);
+
+/// \brief Get the list of the registered benchmarks.
+inline std::vector<BenchFunction>& getRegistry()
+{
+    static std::vector<BenchFunction> registry;
+    return registry;
+}
+
+/// \brief Registers a benchmark function at static initialization time.
+struct Registrar
+{
+    explicit Registrar(const BenchFunction function) { getRegistry().push_back(function); }
+};
+
+}  // namespace bench
+
+/// \def  CBBENCH(NAME)
+///
+/// Defines a benchmark function registered in the colorboy-bench target.
+#define CBBENCH(NAME)                                                                              \
+    static void NAME(bench::Runner& runner);                                                       \
+    static const bench::Registrar NAME##_registrar(&NAME);                                         \
+    static void NAME(bench::Runner& runner)
+
+#endif /* BENCH_H_ */
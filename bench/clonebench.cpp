@@ -0,0 +1,128 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      clonebench.cpp
+///
+/// \brief     Latency and memory of the console clones and of the arena's forks.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "consolearena.h"
+
+#include <cstdio>
+
+#include <malloc.h>
+#include <unistd.h>
+
+namespace
+{
+/// \brief Get the resident memory of the process, in bytes.
+size_t getResidentBytes()
+{
+    std::unique_ptr<FILE, decltype(&fclose)> statmFile(std::fopen("/proc/self/statm", "r"),
+                                                       &fclose);
+    size_t sizePages = 0;
+    size_t residentPages = 0;
+    if ((statmFile == nullptr) ||
+        (std::fscanf(statmFile.get(), "%zu %zu", &sizePages, &residentPages) != 2))
+    {
+        return 0;
+    }
+
+    return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+/// \brief Time the forks of an arena, each fork's console runs a search step before release.
+void measureForks(bench::Runner& runner,
+                  const std::string& name,
+                  const Console& root,
+                  const ConsoleArena::ForkMode mode)
+{
+    if (runner.isSelected(name) == false)
+    {
+        return;
+    }
+
+    ConsoleArena arena(root, 1, mode);
+
+    std::vector<double> samplesNs(runner.getSamplesCount());
+    for (double& sampleNs : samplesNs)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        Console* console = arena.fork();
+        const auto end = std::chrono::steady_clock::now();
+
+        // The boot ROM clears the VRAM: the step writes a few pages, like a game's frame.
+        console->runCycles(2000);
+        arena.release(console);
+
+        sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    runner.report(name, samplesNs, 1, "fork");
+}
+
+}  // namespace
+
+CBBENCH(consoleClone)
+{
+    const std::pair<GBType, const char*> types[] = {{GBType::eGBTYPE_dmg, "dmg"},
+                                                    {GBType::eGBTYPE_cgb, "cgb"}};
+
+    for (const auto& [type, typeName] : types)
+    {
+        // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+        Console root(type, std::vector<uint8_t>(2 * Cartridge::eROMBankSize, 0));
+        root.powerOn();
+
+        const std::string cloneName = std::string("clone/") + typeName;
+        runner.measure(cloneName, 20, 1, "clone", [&]() { root.clone(); });
+
+        measureForks(runner,
+                     std::string("fork/full/") + typeName,
+                     root,
+                     ConsoleArena::ForkMode::eFORKMODE_full);
+        measureForks(runner,
+                     std::string("fork/writtenpages/") + typeName,
+                     root,
+                     ConsoleArena::ForkMode::eFORKMODE_writtenPages);
+
+        if (runner.isSelected(cloneName) == true)
+        {
+            // The clones own all their memory but the ROM, the arena preallocates them.
+            // The freed memory of the previous measures is given back, the clones fault it in.
+            malloc_trim(0);
+
+            const size_t clonesCount = 64;
+            const size_t residentBefore = getResidentBytes();
+            const ConsoleArena arena(root, clonesCount, ConsoleArena::ForkMode::eFORKMODE_full);
+            const size_t residentAfter = getResidentBytes();
+
+            std::printf("{\"benchmark\":\"%s/summary\",\"bytes_per_clone\":%zu,"
+                        "\"console_bytes\":%zu,\"state_bytes\":%zu}\n",
+                        cloneName.c_str(),
+                        (residentAfter - residentBefore) / clonesCount,
+                        sizeof(Console),
+                        root.getStateSize());
+        }
+    }
+}
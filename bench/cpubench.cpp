@@ -0,0 +1,217 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      cpubench.cpp
+///
+/// \brief     Micro benchmarks of the CPU, the MMU and the interrupts check.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "cpu.h"
+#include "mmu.h"
+
+namespace
+{
+/// \brief A CPU alone, running a program from a flat 64 KB memory.
+struct CpuRig
+{
+    /// \brief Constructor.
+    ///
+    /// \param program instructions repeated from 0x0000 up to the final jump back to 0x0000.
+    explicit CpuRig(const std::vector<uint8_t>& program) : memory(0x10000, 0), cpu(mmu)
+    {
+        const uint16_t loopEnd = 0x7FF0;
+        for (uint16_t address = 0; address + program.size() <= loopEnd;
+             address += program.size())
+        {
+            std::copy(program.begin(), program.end(), memory.begin() + address);
+        }
+        // JP 0x0000, right after the last complete copy of the program.
+        const uint16_t jumpAddress = loopEnd - (loopEnd % program.size());
+        memory[jumpAddress] = 0xC3;
+        memory[jumpAddress + 1] = 0x00;
+        memory[jumpAddress + 2] = 0x00;
+
+        // Replace the boot ROM mapped by the CPU.
+        mmu.mapDataBufferToMemory(memory, 0);
+    }
+
+    Mmu mmu;                      ///< Memory map.
+    std::vector<uint8_t> memory;  ///< The whole address space.
+    Cpu cpu;                      ///< CPU under test.
+};
+
+/// \brief Build a program out of the opcodes of a group.
+///
+/// \param first first opcode of the group.
+/// \param last last opcode of the group.
+/// \param prefixed true to prefix each opcode with 0xCB.
+std::vector<uint8_t> makeProgram(const uint8_t first, const uint8_t last, const bool prefixed)
+{
+    std::vector<uint8_t> program;
+    for (uint16_t opcode = first; opcode <= last; ++opcode)
+    {
+        // Skip the (HL) operands and HALT, they measure the memory or stop the CPU.
+        if (((opcode & 0x07) == 0x06) || ((prefixed == false) && (opcode == 0x76)))
+        {
+            continue;
+        }
+
+        if (prefixed == true)
+        {
+            program.push_back(0xCB);
+        }
+        program.push_back(static_cast<uint8_t>(opcode));
+    }
+
+    return program;
+}
+
+/// \brief Time the CPU running a program.
+void measureProgram(bench::Runner& runner,
+                    const std::string& name,
+                    const std::vector<uint8_t>& program,
+                    const std::function<void(CpuRig&)>& setUp = nullptr)
+{
+    if (runner.isSelected(name) == false)
+    {
+        return;
+    }
+
+    CpuRig rig(program);
+    if (setUp != nullptr)
+    {
+        setUp(rig);
+    }
+
+    const uint32_t cyclesPerIteration = 100000;
+    runner.measure(name, 1, cyclesPerIteration, "cycle", [&rig]() {
+        for (uint32_t cycle = 0; cycle < cyclesPerIteration; ++cycle)
+        {
+            rig.cpu.cycle();
+        }
+    });
+}
+
+}  // namespace
+
+CBBENCH(cpuOpcodes)
+{
+    // Instruction dispatch alone.
+    measureProgram(runner, "micro/cpu/nop", {0x00});
+
+    // ADD, ADC, SUB, SBC, AND, XOR, OR and CP on registers.
+    measureProgram(runner, "micro/cpu/alu", makeProgram(0x80, 0xBF, false));
+
+    // INC r and DEC r.
+    measureProgram(runner,
+                   "micro/cpu/incdec",
+                   {0x04, 0x05, 0x0C, 0x0D, 0x14, 0x15, 0x1C, 0x1D, 0x24, 0x25, 0x2C, 0x2D});
+
+    // LD r,r'.
+    measureProgram(runner, "micro/cpu/ldrr", makeProgram(0x40, 0x7F, false));
+
+    // LD r,(HL) and LD (HL),r in the work RAM, HL is set by LD HL,0xC000.
+    std::vector<uint8_t> memoryProgram = {0x21, 0x00, 0xC0};
+    for (const uint8_t opcode : {0x46, 0x4E, 0x56, 0x5E, 0x7E, 0x70, 0x71, 0x72, 0x73, 0x77})
+    {
+        memoryProgram.push_back(opcode);
+    }
+    measureProgram(runner, "micro/cpu/ldmem", memoryProgram);
+
+    // 0xCB prefixed rotates and shifts, BIT, RES and SET.
+    measureProgram(runner, "micro/cpu/cb/rotate", makeProgram(0x00, 0x3F, true));
+    measureProgram(runner, "micro/cpu/cb/bit", makeProgram(0x40, 0x7F, true));
+    measureProgram(runner, "micro/cpu/cb/res", makeProgram(0x80, 0xBF, true));
+    measureProgram(runner, "micro/cpu/cb/set", makeProgram(0xC0, 0xFF, true));
+}
+
+// =================================================================================================
+
+CBBENCH(cpuInterruptsCheck)
+{
+    // The check runs before every instruction: nothing enabled, nothing pending.
+    measureProgram(runner, "micro/irq/none", {0x00}, [](CpuRig& rig) {
+        rig.memory[MemoryAreas::eMEMADDR_eireg] = 0x00;
+        rig.memory[HardwareIORegisters::eIOREG_if] = 0x00;
+    });
+
+    // Every interrupt requested and enabled, but masked by DI: the check reads both registers
+    // without servicing anything (IF would never be acknowledged here).
+    std::vector<uint8_t> program(16, 0x00);
+    program[0] = 0xF3;
+    measureProgram(runner, "micro/irq/masked", program, [](CpuRig& rig) {
+        rig.memory[MemoryAreas::eMEMADDR_eireg] = 0x1F;
+        rig.memory[HardwareIORegisters::eIOREG_if] = 0x1F;
+    });
+}
+
+// =================================================================================================
+
+CBBENCH(mmuAccess)
+{
+    Mmu mmu;
+    std::vector<uint8_t> memory(0x10000, 0);
+    mmu.mapDataBufferToMemory(memory, 0);
+
+    uint8_t ioRegister = 0;
+    mmu.setIOHandlers(HardwareIORegisters::eIOREG_lcdc,
+                      [&ioRegister]() { return ioRegister; },
+                      [&ioRegister](const uint8_t value) { ioRegister = value; });
+
+    const uint32_t accessesPerIteration = 0x2000;
+    volatile uint8_t sink = 0;
+
+    runner.measure("micro/mmu/read/wram", 1, accessesPerIteration, "access", [&]() {
+        uint8_t sum = 0;
+        for (uint32_t idx = 0; idx < accessesPerIteration; ++idx)
+        {
+            sum += mmu.readByte(MemoryAreas::eMEMADDR_wrambank0start + idx);
+        }
+        sink = sum;
+    });
+
+    runner.measure("micro/mmu/write/wram", 1, accessesPerIteration, "access", [&]() {
+        for (uint32_t idx = 0; idx < accessesPerIteration; ++idx)
+        {
+            mmu.writeByte(idx & 0xFF, MemoryAreas::eMEMADDR_wrambank0start + idx);
+        }
+    });
+
+    runner.measure("micro/mmu/read/io", 1, accessesPerIteration, "access", [&]() {
+        uint8_t sum = 0;
+        for (uint32_t idx = 0; idx < accessesPerIteration; ++idx)
+        {
+            sum += mmu.readByte(HardwareIORegisters::eIOREG_lcdc);
+        }
+        sink = sum;
+    });
+
+    runner.measure("micro/mmu/write/io", 1, accessesPerIteration, "access", [&]() {
+        for (uint32_t idx = 0; idx < accessesPerIteration; ++idx)
+        {
+            mmu.writeByte(idx & 0xFF, HardwareIORegisters::eIOREG_lcdc);
+        }
+    });
+
+    static_cast<void>(sink);
+}
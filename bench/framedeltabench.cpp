@@ -0,0 +1,74 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framedeltabench.cpp
+///
+/// \brief     Cost of the frame delta, to be compared with a frame period of 16.74 ms.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "framedelta.h"
+#include "ppu.h"
+
+#include <algorithm>
+#include <random>
+
+CBBENCH(frameDelta)
+{
+    std::vector<uint32_t> frame(Ppu::eFramePixels);
+    std::mt19937 rng(42);
+    const uint32_t shades[4] = {0xFFFFFFFF, 0xFFAAAAAA, 0xFF555555, 0xFF000000};
+    for (uint32_t& pixel : frame)
+    {
+        pixel = shades[rng() % 4];
+    }
+
+    // Same frame over and over: nothing changes.
+    FrameDelta frameDelta(Ppu::eFrameWidth, Ppu::eFrameHeight);
+    frameDelta.update(frame.data());
+    runner.measure("framedelta/static", 50, Ppu::eFramePixels, "pixel", [&]() {
+        frameDelta.update(frame.data());
+    });
+
+    // A 16x16 sprite moving one pixel per frame.
+    uint32_t spriteX = 0;
+    runner.measure("framedelta/sprite", 50, Ppu::eFramePixels, "pixel", [&]() {
+        for (uint32_t y = 64; y < 80; ++y)
+        {
+            for (uint32_t x = 0; x < 16; ++x)
+            {
+                frame[(y * Ppu::eFrameWidth) + ((spriteX + x) % Ppu::eFrameWidth)] ^= 0x00FFFFFF;
+            }
+        }
+        spriteX = (spriteX + 1) % Ppu::eFrameWidth;
+        frameDelta.update(frame.data());
+    });
+
+    // Full screen scrolling: every line changes.
+    std::vector<uint32_t> scrolled(Ppu::eFramePixels);
+    runner.measure("framedelta/scroll", 50, Ppu::eFramePixels, "pixel", [&]() {
+        std::rotate_copy(frame.begin(), frame.begin() + 1, frame.end(), scrolled.begin());
+        frame.swap(scrolled);
+        frameDelta.update(frame.data());
+    });
+}
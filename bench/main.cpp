@@ -0,0 +1,68 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      main.cpp
+///
+/// \brief     Entry point of the colorboy-bench target.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    uint32_t samples = 50;
+    std::string romsDirectory = "gb-test-roms";
+
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        if ((std::strcmp(argv[argIdx], "--filter") == 0) && (argIdx + 1 < argc))
+        {
+            filter = argv[++argIdx];
+        }
+        else if ((std::strcmp(argv[argIdx], "--samples") == 0) && (argIdx + 1 < argc))
+        {
+            samples = std::max(1, std::atoi(argv[++argIdx]));
+        }
+        else if ((std::strcmp(argv[argIdx], "--roms") == 0) && (argIdx + 1 < argc))
+        {
+            romsDirectory = argv[++argIdx];
+        }
+        else
+        {
+            std::printf("Usage: %s [--filter SUBSTRING] [--samples COUNT] [--roms DIRECTORY]\n",
+                        argv[0]);
+            return 1;
+        }
+    }
+
+    bench::Runner runner(filter, samples, romsDirectory);
+    for (const bench::BenchFunction function : bench::getRegistry())
+    {
+        function(runner);
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      moviebench.cpp
+///
+/// \brief     Speed of a movie's replay, with its per-frame state checks.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+#include <fstream>
+
+CBBENCH(movieReplay)
+{
+    if ((runner.isSelected("movie/emulate") == false) &&
+        (runner.isSelected("movie/replay") == false))
+    {
+        return;
+    }
+
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    const std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+    const std::filesystem::path cartPath = tempDir / "colorboy-bench-blank.gb";
+    const std::filesystem::path moviePath = tempDir / "colorboy-bench.cbmv";
+    {
+        std::ofstream cartFile(cartPath, std::ios::binary);
+        const std::vector<char> blankROM(2 * Cartridge::eROMBankSize, 0);
+        cartFile.write(blankROM.data(), blankROM.size());
+    }
+
+    const uint32_t framesCount = 120;
+    {
+        Console console(GBType::eGBTYPE_dmg, cartPath);
+        console.powerOn();
+        console.startMovieRecording();
+        for (uint32_t frame = 0; frame < framesCount; ++frame)
+        {
+            console.setJoypadButtons(static_cast<uint8_t>(frame * 37));
+            console.runFrame();
+        }
+        console.stopMovieRecording(moviePath);
+    }
+
+    // Same frames, without the movie.
+    runner.measure("movie/emulate", 1, framesCount, "frame", [&]() {
+        Console console(GBType::eGBTYPE_dmg, cartPath);
+        console.powerOn();
+        for (uint32_t frame = 0; frame < framesCount; ++frame)
+        {
+            console.setJoypadButtons(static_cast<uint8_t>(frame * 37));
+            console.runFrame();
+        }
+    });
+
+    uint64_t mismatchesCount = 0;
+    runner.measure("movie/replay", 1, framesCount, "frame", [&]() {
+        Console console(GBType::eGBTYPE_dmg, cartPath);
+        console.playMovie(moviePath);
+        while (console.isMoviePlaying() == true)
+        {
+            console.runFrame();
+        }
+        mismatchesCount += console.getMovieMismatchesCount();
+    });
+    CBASSERT(mismatchesCount == 0, "The movie's replay diverged");
+
+    std::filesystem::remove(moviePath);
+    std::filesystem::remove(cartPath);
+}
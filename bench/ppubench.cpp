@@ -0,0 +1,81 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      ppubench.cpp
+///
+/// \brief     Micro benchmark of the PPU's tile decoding and scanline rendering.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "mmu.h"
+#include "ppu.h"
+
+CBBENCH(ppuRender)
+{
+    // Pseudo random tiles, maps and sprites so that no pixel takes a shortcut.
+    std::vector<uint8_t> memory(0x10000, 0);
+    uint32_t seed = 0x12345678;
+    for (uint32_t address = MemoryAreas::eMEMADDR_vrambank0start;
+         address < MemoryAreas::eMEMADDR_wrambank0start;
+         ++address)
+    {
+        seed = seed * 1664525 + 1013904223;
+        memory[address] = seed >> 24;
+    }
+    for (uint8_t sprite = 0; sprite < 40; ++sprite)
+    {
+        const uint16_t oamAddr = MemoryAreas::eMEMADDR_oamstart + (sprite * 4);
+        memory[oamAddr] = 16 + ((sprite * 37) % 144);
+        memory[oamAddr + 1] = 8 + ((sprite * 53) % 160);
+        memory[oamAddr + 2] = sprite;
+        memory[oamAddr + 3] = (sprite & 0x03) << 5;
+    }
+    memory[HardwareIORegisters::eIOREG_bgp] = 0xE4;
+    memory[HardwareIORegisters::eIOREG_obp0] = 0xE4;
+    memory[HardwareIORegisters::eIOREG_obp1] = 0x1B;
+    memory[HardwareIORegisters::eIOREG_wy] = 72;
+    memory[HardwareIORegisters::eIOREG_wx] = 87;
+
+    Mmu mmu;
+    mmu.mapDataBufferToMemory(memory, 0);
+
+    // LCD on, 0x8000 tile data, and BG only or BG + window + sprites.
+    const std::pair<const char*, uint8_t> layers[] = {{"micro/ppu/frame/bg", 0x91},
+                                                      {"micro/ppu/frame/all", 0xB3}};
+    for (const auto& layer : layers)
+    {
+        memory[HardwareIORegisters::eIOREG_lcdc] = layer.second;
+
+        Ppu ppu(mmu);
+        ppu.setVRAM(memory.data() + MemoryAreas::eMEMADDR_vrambank0start);
+
+        uint32_t cpuCycle = 0;
+        runner.measure(layer.first, 1, Ppu::eFramePixels, "pixel", [&ppu, &cpuCycle]() {
+            const uint64_t framesCount = ppu.getFramesCount();
+            while (ppu.getFramesCount() == framesCount)
+            {
+                cpuCycle += 4;
+                ppu.cycle(cpuCycle);
+            }
+        });
+    }
+}
@@ -0,0 +1,86 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      profilerbench.cpp
+///
+/// \brief     Cost of the guest code sampling profiler per frame.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+CBBENCH(guestProfiler)
+{
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    const std::vector<uint8_t> blankROM(2 * Cartridge::eROMBankSize, 0);
+
+    // Sampling periods in master clocks, 0 without profiling.
+    double baseMedianNs = 0.0;
+    for (const uint32_t sampleClocks : {0u, 4096u, 256u})
+    {
+        const std::string name = "profiler/" + std::to_string(sampleClocks);
+        if (runner.isSelected(name) == false)
+        {
+            continue;
+        }
+
+        Console console(GBType::eGBTYPE_dmg, blankROM);
+        console.setAudioMode(ApuMode::eAPUMODE_statusonly);
+        console.powerOn();
+        if (sampleClocks > 0)
+        {
+            console.startProfiling(sampleClocks);
+        }
+
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            console.runFrame();
+        }
+
+        const uint64_t startClock = console.getClock();
+        std::vector<double> samplesNs(runner.getSamplesCount());
+        for (double& sampleNs : samplesNs)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            console.runFrame();
+            const auto end = std::chrono::steady_clock::now();
+
+            sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+        }
+        const double frameClocks =
+            static_cast<double>(console.getClock() - startClock) / samplesNs.size();
+        runner.report(name, samplesNs, frameClocks, "clock");
+
+        std::sort(samplesNs.begin(), samplesNs.end());
+        const double medianNs = samplesNs[samplesNs.size() / 2];
+        if (sampleClocks == 0)
+        {
+            baseMedianNs = medianNs;
+        }
+        else if (baseMedianNs > 0.0)
+        {
+            std::printf("{\"benchmark\":\"%s/summary\",\"overhead_percent\":%.2f}\n",
+                        name.c_str(),
+                        ((medianNs / baseMedianNs) - 1.0) * 100.0);
+        }
+    }
+}
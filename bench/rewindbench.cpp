@@ -0,0 +1,86 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      rewindbench.cpp
+///
+/// \brief     Recording and seeking in the rewind buffer.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+#include "rewindbuffer.h"
+
+#include <random>
+#include <vector>
+
+CBBENCH(rewind)
+{
+    Console console(GBType::eGBTYPE_cgb, std::filesystem::path());
+    std::vector<uint8_t> state(console.getStateSize());
+    console.saveState(state.data(), state.size());
+
+    // A game changes a few dozens bytes of its state per frame.
+    std::mt19937 rng(42);
+    auto nextFrame = [&]() {
+        for (uint32_t change = 0; change < 48; ++change)
+        {
+            state[rng() % state.size()] = static_cast<uint8_t>(rng());
+        }
+    };
+
+    const size_t budget = 64 << 20;
+    RewindBuffer rewindBuffer(state.size(), budget);
+
+    runner.measure("rewind/push", 60, state.size(), "byte", [&]() {
+        nextFrame();
+        rewindBuffer.push(state.data());
+    });
+
+    if (runner.isSelected("rewind/footprint") == true)
+    {
+        rewindBuffer.clear();
+        for (uint32_t frame = 0; frame < 600; ++frame)
+        {
+            nextFrame();
+            rewindBuffer.push(state.data());
+        }
+
+        const double frameBytes = static_cast<double>(rewindBuffer.getUsedBytes()) / 600;
+        std::printf("{\"benchmark\":\"rewind/footprint\",\"state_bytes\":%zu,"
+                    "\"bytes_per_frame\":%.1f,\"minutes_per_64MiB\":%.1f}\n",
+                    state.size(),
+                    frameBytes,
+                    (static_cast<double>(budget) * 15 / 16) / frameBytes / 60 / 60);
+    }
+
+    // Worst case seek: a keyframe followed by a full interval of deltas.
+    rewindBuffer.clear();
+    for (uint32_t frame = 0; frame < RewindBuffer::eKeyframeInterval; ++frame)
+    {
+        nextFrame();
+        rewindBuffer.push(state.data());
+    }
+    runner.measure("rewind/seek", 10, state.size(), "byte", [&]() {
+        rewindBuffer.rewind(0, state.data());
+    });
+}
@@ -0,0 +1,108 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      romframesbench.cpp
+///
+/// \brief     Macro benchmark of whole frames emulated headless on real ROMs.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+namespace
+{
+/// \brief Time the frames of a console once the boot ROM is done.
+void measureFrames(bench::Runner& runner, const std::string& name, Console& console)
+{
+    console.powerOn();
+
+    // The DMG boot ROM takes about 2.5 seconds.
+    for (uint32_t frame = 0; frame < 180; ++frame)
+    {
+        console.runFrame();
+    }
+
+    const uint64_t startClock = console.getClock();
+    std::vector<double> samplesNs(runner.getSamplesCount());
+    for (double& sampleNs : samplesNs)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        console.runFrame();
+        const auto end = std::chrono::steady_clock::now();
+
+        sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    const double frameClocks =
+        static_cast<double>(console.getClock() - startClock) / samplesNs.size();
+    runner.report(name, samplesNs, frameClocks, "clock");
+
+    std::sort(samplesNs.begin(), samplesNs.end());
+    std::printf("{\"benchmark\":\"%s/summary\",\"frames_per_second\":%.1f}\n",
+                name.c_str(),
+                1e9 / samplesNs[samplesNs.size() / 2]);
+}
+
+}  // namespace
+
+CBBENCH(romFrames)
+{
+    // The individual cpu_instrs ROMs of the test ROMs submodule, or the ROMs of the directory.
+    std::error_code error;
+    std::filesystem::path romsDirectory = runner.getROMsDirectory();
+    if (std::filesystem::is_directory(romsDirectory / "cpu_instrs" / "individual", error) == true)
+    {
+        romsDirectory /= "cpu_instrs/individual";
+    }
+
+    std::vector<std::filesystem::path> romsPaths;
+    for (const auto& entry : std::filesystem::directory_iterator(romsDirectory, error))
+    {
+        if ((entry.path().extension() == ".gb") || (entry.path().extension() == ".gbc"))
+        {
+            romsPaths.push_back(entry.path());
+        }
+    }
+    std::sort(romsPaths.begin(), romsPaths.end());
+
+    for (const std::filesystem::path& romPath : romsPaths)
+    {
+        const std::string name = "macro/frames/" + romPath.stem().string();
+        if (runner.isSelected(name) == false)
+        {
+            continue;
+        }
+
+        Console console(GBType::eGBTYPE_dmg, romPath);
+        if (console.isCartridgeValid() == true)
+        {
+            measureFrames(runner, name, console);
+        }
+    }
+
+    // Without ROMs: a blank cartridge, on which the boot ROM waits for a valid logo forever.
+    if ((romsPaths.empty() == true) && (runner.isSelected("macro/frames/blank") == true))
+    {
+        Console console(GBType::eGBTYPE_dmg,
+                        std::vector<uint8_t>(2 * Cartridge::eROMBankSize, 0));
+        measureFrames(runner, "macro/frames/blank", console);
+    }
+}
@@ -0,0 +1,97 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      runaheadbench.cpp
+///
+/// \brief     Cost of the run-ahead per displayed frame.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+#include <fstream>
+
+CBBENCH(runAhead)
+{
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    const std::filesystem::path cartPath =
+        std::filesystem::temp_directory_path() / "colorboy-bench-blank.gb";
+    {
+        std::ofstream cartFile(cartPath, std::ios::binary);
+        const std::vector<char> blankROM(2 * Cartridge::eROMBankSize, 0);
+        cartFile.write(blankROM.data(), blankROM.size());
+    }
+
+    // 70224 clocks per frame at 4.194304 MHz.
+    const uint32_t frameClocks = 70224;
+    const double frameDurationMs = frameClocks * 1e3 / 4194304.0;
+
+    double baseMedianNs = 0.0;
+    for (uint32_t frames = 0; frames <= 3; ++frames)
+    {
+        const std::string name = "runahead/" + std::to_string(frames);
+        if (runner.isSelected(name) == false)
+        {
+            continue;
+        }
+
+        Console console(GBType::eGBTYPE_dmg, cartPath);
+        console.setRunAhead(frames);
+        console.powerOn();
+
+        // Skip the boot ROM's first frames, which clear the VRAM.
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            console.runFrame();
+        }
+
+        std::vector<double> samplesNs(runner.getSamplesCount());
+        for (double& sampleNs : samplesNs)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            console.runFrame();
+            const auto end = std::chrono::steady_clock::now();
+
+            sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+        }
+        runner.report(name, samplesNs, frameClocks, "clock");
+
+        // Each frame ahead removes a frame of input latency, for one more emulated frame.
+        std::sort(samplesNs.begin(), samplesNs.end());
+        const double medianNs = samplesNs[samplesNs.size() / 2];
+        if (frames == 0)
+        {
+            baseMedianNs = medianNs;
+        }
+        else if (baseMedianNs > 0.0)
+        {
+            std::printf("{\"benchmark\":\"%s/summary\",\"latency_saved_ms\":%.2f,"
+                        "\"cpu_overhead\":%.2f}\n",
+                        name.c_str(),
+                        frames * frameDurationMs,
+                        medianNs / baseMedianNs);
+        }
+    }
+
+    std::filesystem::remove(cartPath);
+}
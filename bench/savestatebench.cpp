@@ -0,0 +1,50 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      savestatebench.cpp
+///
+/// \brief     Save and load of a whole console state.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+#include <vector>
+
+CBBENCH(saveLoadState)
+{
+    const std::pair<GBType, const char*> types[] = {{GBType::eGBTYPE_dmg, "dmg"},
+                                                    {GBType::eGBTYPE_cgb, "cgb"}};
+
+    for (const auto& [type, typeName] : types)
+    {
+        // No cartridge: the state holds everything but the cartridge's RAM.
+        Console console(type, std::filesystem::path());
+        std::vector<uint8_t> state(console.getStateSize());
+
+        runner.measure(std::string("savestate/") + typeName, 100, state.size(), "byte", [&]() {
+            console.saveState(state.data(), state.size());
+            console.loadState(state.data(), state.size());
+        });
+    }
+}
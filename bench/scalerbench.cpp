@@ -0,0 +1,89 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      scalerbench.cpp
+///
+/// \brief     Throughput of the upscaling filters.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "ppu.h"
+#include "scaler.h"
+
+#include <memory>
+#include <random>
+
+CBBENCH(scalerFilters)
+{
+    // A frame made of random 8x8 tiles of 4 shades, close to what the PPU produces.
+    std::vector<uint32_t> frame(Ppu::eFramePixels);
+    std::mt19937 rng(42);
+    std::vector<uint32_t> tiles(4 * 64);
+    const uint32_t shades[4] = {0xFFFFFFFF, 0xFFAAAAAA, 0xFF555555, 0xFF000000};
+    for (uint32_t& pixel : tiles)
+    {
+        pixel = shades[rng() % 4];
+    }
+    for (uint32_t y = 0; y < Ppu::eFrameHeight; ++y)
+    {
+        for (uint32_t x = 0; x < Ppu::eFrameWidth; ++x)
+        {
+            const uint32_t tile = ((x / 8) + (y / 8)) % 4;
+            frame[(y * Ppu::eFrameWidth) + x] = tiles[(tile * 64) + ((y % 8) * 8) + (x % 8)];
+        }
+    }
+
+    const std::pair<ScaleFilter, const char*> filters[] = {
+        {ScaleFilter::eSCALEFILTER_nearest2x, "nearest2x"},
+        {ScaleFilter::eSCALEFILTER_nearest3x, "nearest3x"},
+        {ScaleFilter::eSCALEFILTER_nearest4x, "nearest4x"},
+        {ScaleFilter::eSCALEFILTER_scale2x, "scale2x"},
+        {ScaleFilter::eSCALEFILTER_scale3x, "scale3x"}};
+
+    const uint32_t poolThreads = std::clamp(std::thread::hardware_concurrency(), 1u, 4u) - 1;
+    ThreadPool threadPool(poolThreads);
+
+    for (const auto& [filter, filterName] : filters)
+    {
+        const uint8_t factor = Scaler::getScaleFactor(filter);
+        std::vector<uint32_t> output(Ppu::eFramePixels * factor * factor);
+        const double outputMPixels = output.size();
+
+        Scaler scaler(Ppu::eFrameWidth, Ppu::eFrameHeight);
+        scaler.setFilter(filter);
+
+        runner.measure(std::string("scaler/") + filterName + "/serial",
+                       20,
+                       outputMPixels,
+                       "pixel",
+                       [&]() { scaler.scale(frame.data(), output.data()); });
+
+        scaler.setThreadPool(&threadPool);
+        runner.measure(std::string("scaler/") + filterName + "/pool" +
+                           std::to_string(poolThreads + 1),
+                       20,
+                       outputMPixels,
+                       "pixel",
+                       [&]() { scaler.scale(frame.data(), output.data()); });
+    }
+}
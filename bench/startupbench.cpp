@@ -0,0 +1,109 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      startupbench.cpp
+///
+/// \brief     Startup latency with the boot ROM and with the fast start.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "console.h"
+
+#include <cstdio>
+
+namespace
+{
+/// \brief Build a cartridge the boot ROM accepts, its entry point loops forever.
+std::vector<uint8_t> makeBootableROM()
+{
+    const uint8_t logo[] = {0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
+                            0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
+                            0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
+                            0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E};
+
+    std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+    std::copy(std::begin(logo), std::end(logo), rom.begin() + 0x0104);
+    // JR -2 at the entry point, and the checksum of the header's zeros.
+    rom[0x0100] = 0x18;
+    rom[0x0101] = 0xFE;
+    rom[0x014D] = 0xE7;
+
+    return rom;
+}
+
+/// \brief Time a console's construction and power on, until the cartridge's entry point.
+double measureStartup(bench::Runner& runner,
+                      const std::string& name,
+                      const std::vector<uint8_t>& rom,
+                      const BootMode mode,
+                      const uint32_t samplesCount)
+{
+    if (runner.isSelected(name) == false)
+    {
+        return 0.0;
+    }
+
+    std::vector<double> samplesNs(samplesCount);
+    for (double& sampleNs : samplesNs)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        Console console(GBType::eGBTYPE_dmg, rom);
+        console.powerOn(mode);
+        while (console.readMemory(0xFF50) == 0)
+        {
+            console.runCycles(1000);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    runner.report(name, samplesNs, 1, "startup");
+
+    std::sort(samplesNs.begin(), samplesNs.end());
+    return samplesNs[samplesNs.size() / 2];
+}
+
+}  // namespace
+
+CBBENCH(consoleStartup)
+{
+    const std::vector<uint8_t> rom = makeBootableROM();
+
+    // The boot ROM runs for seconds, a few samples are enough.
+    const double bootROMNs = measureStartup(runner,
+                                            "startup/bootrom",
+                                            rom,
+                                            BootMode::eBOOTMODE_bootROM,
+                                            std::min<uint32_t>(runner.getSamplesCount(), 3));
+    const double fastStartNs = measureStartup(runner,
+                                              "startup/faststart",
+                                              rom,
+                                              BootMode::eBOOTMODE_fastStart,
+                                              runner.getSamplesCount());
+
+    if ((bootROMNs > 0.0) && (fastStartNs > 0.0))
+    {
+        std::printf("{\"benchmark\":\"startup/summary\",\"speedup\":%.1f}\n",
+                    bootROMNs / fastStartNs);
+    }
+}
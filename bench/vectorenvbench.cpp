@@ -0,0 +1,90 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      vectorenvbench.cpp
+///
+/// \brief     Frames per second of the reinforcement learning environment's batched steps.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "bench.h"
+
+#include "vectorenv.h"
+
+#include <thread>
+
+CBBENCH(vectorEnv)
+{
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t envsCount = 32;
+    const uint32_t frameskip = 4;
+
+    std::vector<uint32_t> threadsCounts = {0};
+    if (hardwareThreads > 1)
+    {
+        threadsCounts.push_back(hardwareThreads - 1);
+    }
+
+    for (const uint32_t threadsCount : threadsCounts)
+    {
+        for (const Observation observation :
+             {Observation::eOBSERVATION_screen, Observation::eOBSERVATION_ram})
+        {
+            const std::string name =
+                std::string("vectorenv/") +
+                ((observation == Observation::eOBSERVATION_screen) ? "screen" : "ram") + "/" +
+                std::to_string(threadsCount + 1);
+            if (runner.isSelected(name) == false)
+            {
+                continue;
+            }
+
+            VectorEnvConfig config;
+            config.envsCount = envsCount;
+            config.threadsCount = threadsCount;
+            config.observation = observation;
+            config.ramAddresses = {0xC000, 0xC001, 0xFF40, 0xFF44};
+
+            // A cartridge with a wrong logo: the boot ROM draws it then waits forever.
+            std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+            std::fill(rom.begin() + 0x0104, rom.begin() + 0x0134, 0xA5);
+            VectorEnv env(GBType::eGBTYPE_dmg, std::move(rom), config);
+            env.setReward("delta(u8[0xFF42]) - 0.01*u16[0xC000]");
+
+            const std::vector<uint8_t> actions(envsCount, JoypadButtons::eBUTTON_a);
+            std::vector<double> samplesNs(runner.getSamplesCount());
+            for (double& sampleNs : samplesNs)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                env.step(actions.data(), frameskip);
+                const auto end = std::chrono::steady_clock::now();
+
+                sampleNs = std::chrono::duration<double, std::nano>(end - start).count();
+            }
+            runner.report(name, samplesNs, envsCount * frameskip, "frame");
+
+            std::sort(samplesNs.begin(), samplesNs.end());
+            std::printf("{\"benchmark\":\"%s/summary\",\"frames_per_second\":%.1f}\n",
+                        name.c_str(),
+                        (envsCount * frameskip * 1e9) / samplesNs[samplesNs.size() / 2]);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framereader.cpp
+///
+/// \brief     Example of an out-of-process reader of the frames exported by Console::exportFrames.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "sharedframe.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <chrono>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// \brief Write a RGBA8888 frame as a binary PPM image.
+static void writePPM(const char* path, const uint8_t* pixels, const uint32_t width,
+                     const uint32_t height)
+{
+    FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    std::fprintf(file, "P6\n%u %u\n255\n", width, height);
+    for (uint32_t idx = 0; idx < width * height; ++idx)
+    {
+        std::fwrite(pixels + (idx * 4), 3, 1, file);
+    }
+    std::fclose(file);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::printf("Usage: %s SEGMENT_NAME [FRAMES_COUNT] [LAST_FRAME.ppm]\n", argv[0]);
+        return 1;
+    }
+
+    const uint64_t framesToRead = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 60;
+
+    const int fd = shm_open(argv[1], O_RDONLY, 0);
+    if (fd < 0)
+    {
+        std::printf("Cannot open the shared memory segment '%s'\n", argv[1]);
+        return 1;
+    }
+
+    struct stat segmentStat;
+    fstat(fd, &segmentStat);
+    const void* mem = mmap(nullptr, segmentStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED)
+    {
+        return 1;
+    }
+
+    const auto* header = static_cast<const sharedframe::SegmentHeader*>(mem);
+    if ((header->magic != sharedframe::eMagic) || (header->version != sharedframe::eVersion))
+    {
+        std::printf("Not a ColorBoy frames segment\n");
+        return 1;
+    }
+
+    uint64_t lastGeneration = 0;
+    for (uint64_t framesRead = 0; framesRead < framesToRead;)
+    {
+        const uint64_t generation = header->generation.load(std::memory_order_acquire);
+        if (generation == lastGeneration)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        const uint32_t slot = header->latestSlot.load(std::memory_order_acquire);
+        const sharedframe::SlotHeader& slotHeader = header->slots[slot];
+        const uint32_t sequence = slotHeader.sequence.load(std::memory_order_acquire);
+        if ((sequence & 0x1) != 0)
+        {
+            continue;
+        }
+
+        // Use the pixels in place, no copy.
+        const uint8_t* pixels = sharedframe::getSlotPixels(header, slot);
+        uint64_t luminance = 0;
+        for (uint32_t idx = 0; idx < header->width * header->height; ++idx)
+        {
+            luminance += pixels[idx * 4];
+        }
+        const uint64_t frameNumber = slotHeader.frameNumber;
+
+        // Lines changed since the previous frame, all of them if the producer does not track it.
+        uint32_t dirtyLines = header->height;
+        if ((slotHeader.flags & sharedframe::eSLOTFLAG_dirtylines) != 0)
+        {
+            dirtyLines = 0;
+            for (const uint64_t word : slotHeader.dirtyLines)
+            {
+                dirtyLines += __builtin_popcountll(word) * header->dirtyLineHeight;
+            }
+        }
+
+        if ((framesRead + 1 == framesToRead) && (argc > 3))
+        {
+            writePPM(argv[3], pixels, header->width, header->height);
+        }
+
+        // The frame was overwritten while we were reading it, try again with the newest one.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slotHeader.sequence.load(std::memory_order_relaxed) != sequence)
+        {
+            continue;
+        }
+
+        std::printf("frame %llu (slot %u): average luminance %llu, %u lines changed\n",
+                    static_cast<unsigned long long>(frameNumber),
+                    slot,
+                    static_cast<unsigned long long>(luminance / (header->width * header->height)),
+                    dirtyLines);
+
+        lastGeneration = generation;
+        ++framesRead;
+    }
+
+    munmap(const_cast<void*>(mem), segmentStat.st_size);
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      fuzzdriver.cpp
+///
+/// \brief     Runs a fuzzing entry point without libFuzzer: on files, on stdin or on random
+///            inputs.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace
+{
+/// \brief Read a whole file, "-" for the standard input.
+///
+/// \return true if the file was read, false otherwise.
+bool readInput(const std::string& path, std::vector<uint8_t>& input)
+{
+    FILE* const file = (path == "-") ? stdin : std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    input.clear();
+    uint8_t buffer[4096];
+    size_t readSize = 0;
+    while ((readSize = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        input.insert(input.end(), buffer, buffer + readSize);
+    }
+
+    const bool valid = (std::ferror(file) == 0);
+    if (file != stdin)
+    {
+        std::fclose(file);
+    }
+
+    return valid;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> paths;
+    uint64_t randomRuns = 0;
+    uint32_t seed = 1;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string arg = argv[argIdx];
+        // --random N: run N random inputs of up to 256 bytes.
+        if ((arg == "--random") && (argIdx + 1 < argc))
+        {
+            randomRuns = std::strtoull(argv[++argIdx], nullptr, 0);
+        }
+        // --seed S: seed of the random inputs, 1 by default.
+        else if ((arg == "--seed") && (argIdx + 1 < argc))
+        {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++argIdx], nullptr, 0));
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+
+    // afl-fuzz feeds the input through stdin or through the @@ file.
+    if ((paths.empty() == true) && (randomRuns == 0))
+    {
+        paths.push_back("-");
+    }
+
+    std::vector<uint8_t> input;
+    for (const std::string& path : paths)
+    {
+        if (readInput(path, input) == false)
+        {
+            std::fprintf(stderr, "Cannot read '%s'\n", path.c_str());
+            return 1;
+        }
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+
+    if (randomRuns > 0)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<uint32_t> sizes(1, 256);
+        std::uniform_int_distribution<uint32_t> bytes(0, 0xFF);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t run = 0; run < randomRuns; ++run)
+        {
+            input.resize(sizes(generator));
+            for (uint8_t& byte : input)
+            {
+                byte = static_cast<uint8_t>(bytes(generator));
+            }
+            LLVMFuzzerTestOneInput(input.data(), input.size());
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        std::printf("%llu runs in %.3f s, %.0f execs/s\n",
+                    static_cast<unsigned long long>(randomRuns),
+                    seconds,
+                    (seconds > 0.0) ? randomRuns / seconds : 0.0);
+    }
+
+    return 0;
+}
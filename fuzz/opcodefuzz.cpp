@@ -0,0 +1,392 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      opcodefuzz.cpp
+///
+/// \brief     Fuzzing entry point running the input as CPU instructions, for libFuzzer and AFL.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "cpu.h"
+#include "instructiontracer.h"
+#include "mmu.h"
+#include "savestate.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+enum : uint32_t
+{
+    eMaxProgramSize = 0x8000,  ///< The input is loaded at 0x0000, up to the end of the ROM area.
+    eCyclesBudget = 4096       ///< CPU cycles of a run.
+};
+
+/// \brief Get the length of an instruction, from the opcodes table of the LR35902 manuals.
+///
+/// The CPU has its own table: this one is the reference it is checked against.
+uint8_t getInstructionLength(const uint8_t opcode)
+{
+    switch (opcode)
+    {
+    // Two bytes: 8 bits immediate.
+    case 0x06: case 0x0E: case 0x10: case 0x16: case 0x18: case 0x1E: case 0x20: case 0x26:
+    case 0x28: case 0x2E: case 0x30: case 0x36: case 0x38: case 0x3E: case 0xC6: case 0xCB:
+    case 0xCE: case 0xD6: case 0xDE: case 0xE0: case 0xE6: case 0xE8: case 0xEE: case 0xF0:
+    case 0xF6: case 0xF8: case 0xFE:
+        return 2;
+
+    // Three bytes: 16 bits immediate.
+    case 0x01: case 0x08: case 0x11: case 0x21: case 0x31: case 0xC2: case 0xC3: case 0xC4:
+    case 0xCA: case 0xCC: case 0xCD: case 0xD2: case 0xD4: case 0xDA: case 0xDC: case 0xEA:
+    case 0xFA:
+        return 3;
+
+    default:
+        return 1;
+    }
+}
+
+/// \brief Check if an opcode locks the real CPU up.
+bool isIllegalOpcode(const uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case 0xD3: case 0xDB: case 0xDD: case 0xE3: case 0xE4: case 0xEB: case 0xEC: case 0xED:
+    case 0xF4: case 0xFC: case 0xFD:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/// \brief Print a record in the gameboy-doctor style.
+void printRecord(const char* const label, const cputrace::Record& record)
+{
+    std::fprintf(stderr,
+                 "%s A:%02X F:%02X B:%02X C:%02X D:%02X E:%02X H:%02X L:%02X SP:%04X PC:%04X "
+                 "OP:%02X\n",
+                 label,
+                 record.a,
+                 record.f,
+                 record.b,
+                 record.c,
+                 record.d,
+                 record.e,
+                 record.h,
+                 record.l,
+                 record.sp,
+                 record.pc,
+                 record.opcode);
+}
+
+/// \brief A CPU alone in a flat 64 KB memory, reset in O(written pages) between the runs.
+class OpcodeArena : public InstructionTracer
+{
+public:
+    OpcodeArena() : m_memory(0x10000, 0), m_cpu(m_mmu)
+    {
+        // Replace the boot ROM mapped by the CPU.
+        m_mmu.mapDataBufferToMemory(m_memory, 0);
+        m_mmu.setWrittenPages(&m_writtenPages);
+        m_cpu.setInstructionTracer(this);
+
+        StateWriter measure(nullptr, 0);
+        m_cpu.saveState(measure);
+        m_powerOnState.resize(measure.finish());
+        StateWriter writer(m_powerOnState.data(), m_powerOnState.size());
+        m_cpu.saveState(writer);
+        writer.finish();
+    }
+
+    /// \brief Run a program from the power on state.
+    void run(const uint8_t* const program, const size_t size)
+    {
+        reset();
+
+        m_programSize = std::min<size_t>(size, eMaxProgramSize);
+        std::memcpy(m_memory.data(), program, m_programSize);
+
+        m_hasPrevious = false;
+        m_stopped = false;
+        for (uint32_t cycle = 0; (cycle < eCyclesBudget) && (m_stopped == false); ++cycle)
+        {
+            m_cpu.cycle();
+        }
+    }
+
+    void traceInstruction(const cputrace::Record& record) override
+    {
+        if ((record.f & 0x0F) != 0)
+        {
+            fail("the low nibble of F is not zero", record);
+        }
+
+        const uint64_t instructionsCount = m_cpu.getInstructionsCount();
+        const uint64_t interruptsCount = m_cpu.getInterruptsCount();
+        if (m_hasPrevious == true)
+        {
+            // The CB prefix and its instruction are fetched one after the other.
+            const uint64_t fetchedInstructions = (m_previous.opcode == 0xCB) ? 2 : 1;
+            if (instructionsCount - m_previousInstructionsCount != fetchedInstructions)
+            {
+                fail("the CB prefix state is not cleared", record);
+            }
+
+            checkSuccessor(record, interruptsCount != m_previousInterruptsCount);
+        }
+
+        // The real CPU locks up, the run stops before the instruction runs.
+        if (isIllegalOpcode(record.opcode) == true)
+        {
+            m_stopped = true;
+        }
+
+        // The instruction may overwrite its operands or the stack, keep them.
+        m_previous = record;
+        m_previousInstructionsCount = instructionsCount;
+        m_previousInterruptsCount = interruptsCount;
+        m_operand = readWord(record.pc + 1);
+        m_stackTop = readWord(record.sp);
+        m_hasPrevious = true;
+    }
+
+private:
+    /// \brief Zero the memory written by the last run and restore the power on CPU state.
+    void reset()
+    {
+        for (size_t idx = 0; idx < m_writtenPages.size(); ++idx)
+        {
+            std::memset(&m_memory[m_writtenPages[idx] << 8], 0, 0x100);
+        }
+        m_writtenPages.clear();
+        std::memset(m_memory.data(), 0, m_programSize);
+
+        StateReader reader(m_powerOnState.data(), m_powerOnState.size());
+        if (m_cpu.loadState(reader) == false)
+        {
+            std::fprintf(stderr, "Cannot restore the CPU state\n");
+            std::abort();
+        }
+    }
+
+    /// \brief Read a little endian word from the memory.
+    uint16_t readWord(const uint16_t address) const
+    {
+        return m_memory[address] | (m_memory[static_cast<uint16_t>(address + 1)] << 8);
+    }
+
+    /// \brief Check the PC, SP and stack after the previous instruction.
+    ///
+    /// \param record the instruction fetched after it.
+    /// \param interrupted was an interrupt dispatched in between?
+    void checkSuccessor(const cputrace::Record& record, const bool interrupted)
+    {
+        const cputrace::Record& previous = m_previous;
+        const uint8_t opcode = previous.opcode;
+        const uint16_t nextPC = previous.pc + getInstructionLength(opcode);
+        const uint16_t hl = (previous.h << 8) | previous.l;
+
+        // Condition of the conditional jumps, calls and returns: NZ, Z, NC, C.
+        const uint8_t conditionFlag = ((opcode & 0x10) == 0) ? 0x80 : 0x10;
+        const bool conditionSet = (previous.f & conditionFlag) != 0;
+        const bool conditionMet = (((opcode & 0x08) != 0) == conditionSet);
+
+        uint16_t expectedPC = nextPC;
+        uint16_t expectedSP = previous.sp;
+        bool pushed = false;
+        uint16_t pushedWord = nextPC;
+        switch (opcode)
+        {
+        case 0x18:
+            expectedPC = nextPC + static_cast<int8_t>(m_operand & 0xFF);
+            break;
+        case 0x20: case 0x28: case 0x30: case 0x38:
+            expectedPC = (conditionMet == true) ? nextPC + static_cast<int8_t>(m_operand & 0xFF) :
+                                                  nextPC;
+            break;
+        case 0xC3:
+            expectedPC = m_operand;
+            break;
+        case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+            expectedPC = (conditionMet == true) ? m_operand : nextPC;
+            break;
+        case 0xE9:
+            expectedPC = hl;
+            break;
+        case 0xCD:
+            expectedPC = m_operand;
+            pushed = true;
+            break;
+        case 0xC4: case 0xCC: case 0xD4: case 0xDC:
+            expectedPC = (conditionMet == true) ? m_operand : nextPC;
+            pushed = conditionMet;
+            break;
+        case 0xC7: case 0xCF: case 0xD7: case 0xDF: case 0xE7: case 0xEF: case 0xF7: case 0xFF:
+            expectedPC = opcode & 0x38;
+            pushed = true;
+            break;
+        case 0xC9: case 0xD9:
+            expectedPC = m_stackTop;
+            expectedSP = previous.sp + 2;
+            break;
+        case 0xC0: case 0xC8: case 0xD0: case 0xD8:
+            expectedPC = (conditionMet == true) ? m_stackTop : nextPC;
+            expectedSP = previous.sp + ((conditionMet == true) ? 2 : 0);
+            break;
+        case 0xC5: case 0xD5: case 0xE5:
+            pushed = true;
+            pushedWord = (opcode == 0xC5) ? ((previous.b << 8) | previous.c) :
+                         (opcode == 0xD5) ? ((previous.d << 8) | previous.e) : hl;
+            break;
+        case 0xF5:
+            pushed = true;
+            pushedWord = (previous.a << 8) | previous.f;
+            break;
+        case 0xC1: case 0xD1: case 0xE1: case 0xF1:
+            expectedSP = previous.sp + 2;
+            checkPoppedWord(opcode, record);
+            break;
+        case 0x31:
+            expectedSP = m_operand;
+            break;
+        case 0x33:
+            expectedSP = previous.sp + 1;
+            break;
+        case 0x3B:
+            expectedSP = previous.sp - 1;
+            break;
+        case 0xE8:
+            expectedSP = previous.sp + static_cast<int8_t>(m_operand & 0xFF);
+            break;
+        case 0xF9:
+            expectedSP = hl;
+            break;
+        default:
+            break;
+        }
+        if (pushed == true)
+        {
+            expectedSP = previous.sp - 2;
+        }
+
+        if (interrupted == false)
+        {
+            if (record.pc != expectedPC)
+            {
+                fail("PC is not the address of the next instruction", record);
+            }
+            if (record.sp != expectedSP)
+            {
+                fail("SP did not move by the pushed or popped bytes", record);
+            }
+        }
+        else
+        {
+            // The dispatch pushes the address of the next instruction and jumps to a vector.
+            if ((record.pc < 0x40) || (record.pc > 0x60) || ((record.pc & 0x07) != 0))
+            {
+                fail("an interrupt dispatch did not jump to a vector", record);
+            }
+            if (record.sp != static_cast<uint16_t>(expectedSP - 2))
+            {
+                fail("SP did not move by the pushed or popped bytes", record);
+            }
+            if (readWord(record.sp) != expectedPC)
+            {
+                fail("an interrupt dispatch did not push the return address", record);
+            }
+        }
+        // The dispatch acknowledges its request in IF, which the pushed word may overlap.
+        const bool pushedOnIF = (interrupted == true) &&
+                                ((expectedSP == HardwareIORegisters::eIOREG_if) ||
+                                 (expectedSP == HardwareIORegisters::eIOREG_if - 1));
+        if ((pushed == true) && (pushedOnIF == false) && (readWord(expectedSP) != pushedWord))
+        {
+            fail("the pushed word is not on the stack", record);
+        }
+    }
+
+    /// \brief Check the register pair loaded by a POP.
+    void checkPoppedWord(const uint8_t opcode, const cputrace::Record& record)
+    {
+        uint16_t popped = 0;
+        uint16_t expected = m_stackTop;
+        switch (opcode)
+        {
+        case 0xC1: popped = (record.b << 8) | record.c; break;
+        case 0xD1: popped = (record.d << 8) | record.e; break;
+        case 0xE1: popped = (record.h << 8) | record.l; break;
+        default:
+            // The low nibble of F does not exist.
+            popped = (record.a << 8) | record.f;
+            expected &= 0xFFF0;
+            break;
+        }
+
+        if (popped != expected)
+        {
+            fail("POP did not load the word on the stack", record);
+        }
+    }
+
+    /// \brief Report a broken invariant and abort: the fuzzer keeps the input as a crash.
+    [[noreturn]] void fail(const char* const invariant, const cputrace::Record& record) const
+    {
+        std::fprintf(stderr, "Invariant broken: %s\n", invariant);
+        if (m_hasPrevious == true)
+        {
+            printRecord("before", m_previous);
+        }
+        printRecord("after ", record);
+        std::abort();
+    }
+
+    Mmu m_mmu;                            ///< Memory map.
+    std::vector<uint8_t> m_memory;        ///< The whole address space.
+    Cpu m_cpu;                            ///< CPU under test.
+    WrittenPages m_writtenPages;          ///< Pages written by the current run.
+    std::vector<uint8_t> m_powerOnState;  ///< CPU state restored before each run.
+    size_t m_programSize = 0;             ///< Size of the current run's program.
+    bool m_stopped = false;               ///< Did the run reach an illegal opcode?
+
+    bool m_hasPrevious = false;                ///< Was an instruction fetched in this run?
+    cputrace::Record m_previous = {};          ///< Last fetched instruction.
+    uint64_t m_previousInstructionsCount = 0;  ///< Instructions fetched up to it.
+    uint64_t m_previousInterruptsCount = 0;    ///< Interrupts dispatched up to it.
+    uint16_t m_operand = 0;                    ///< Its 16 bits operand, before it ran.
+    uint16_t m_stackTop = 0;                   ///< Word at SP, before it ran.
+};
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    // One arena for all the runs, built on the first one.
+    static OpcodeArena arena;
+    arena.run(data, size);
+
+    return 0;
+}
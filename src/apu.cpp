@@ -0,0 +1,727 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      apu.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "apu.h"
+
+#include <algorithm>
+
+namespace
+{
+enum : uint32_t
+{
+    eFrameSequencerPeriod = Apu::eClockRate / 512,  ///< Clocks between frame sequencer steps.
+    eAmplitudeScale = 64,      ///< Mixer level to sample value, 4 channels * 15 * 8 * 64 < 32768.
+    eMaxSamplesPerStep = 512   ///< Samples produced between two frame sequencer steps at most.
+};
+
+/// Bits read back as 1 in each sound register (write only or unused bits).
+constexpr std::array<uint8_t, 0x20> eReadMasks = {
+    0x80, 0x3F, 0x00, 0xFF, 0xBF,  // NR10-NR14
+    0xFF, 0x3F, 0x00, 0xFF, 0xBF,  // NR20-NR24
+    0x7F, 0xFF, 0x9F, 0xFF, 0xBF,  // NR30-NR34
+    0xFF, 0xFF, 0x00, 0x00, 0xBF,  // NR40-NR44
+    0x00, 0x00, 0x70,              // NR50-NR52
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+/// Waveforms of the 4 square duty cycles (12.5%, 25%, 50%, 75%), one bit per step.
+constexpr std::array<uint8_t, 4> eDutyPatterns = {0x01, 0x81, 0x87, 0x7E};
+
+/// Noise channel's clock divisors.
+constexpr std::array<uint8_t, 8> eNoiseDivisors = {8, 16, 32, 48, 64, 80, 96, 112};
+
+}  // namespace
+
+// =================================================================================================
+
+Apu::Apu(Mmu& mmu, Scheduler& scheduler, const uint32_t sampleRate) :
+    m_scheduler(scheduler), m_mode(ApuMode::eAPUMODE_synthesis), m_synthesisPaused(false),
+    m_poweredOn(false),
+    m_frameSequencerStep(0), m_lastTime(0), m_sweepTimer(0), m_sweepEnabled(false),
+    m_sweepFrequency(0), m_lfsr(0x7FFF), m_frameStart(0),
+    m_blips{BlipBuffer(eClockRate, sampleRate, eMaxSamplesPerStep),
+            BlipBuffer(eClockRate, sampleRate, eMaxSamplesPerStep)},
+    m_samples(eMaxSamplesPerStep * 2),
+    // A quarter of a second of latency at most.
+    m_output(sampleRate / 4)
+{
+    m_registers.fill(0);
+    m_waveRAM.fill(0);
+
+    for (uint16_t address = HardwareIORegisters::eIOREG_nr10;
+         address <= HardwareIORegisters::eIOREG_waveend;
+         ++address)
+    {
+        mmu.setIOHandlers(
+            address,
+            [this, address]() -> uint8_t { return readRegister(address); },
+            [this, address](const uint8_t byte) { writeRegister(address, byte); });
+    }
+
+    m_lastTime = m_scheduler.getNow();
+    m_frameStart = m_lastTime;
+    m_scheduler.setHandler(SchedulerEvent::eSCHEDEVENT_apuframesequencer,
+                           [this](const uint64_t deadline) { stepFrameSequencer(deadline); });
+    m_scheduler.schedule(SchedulerEvent::eSCHEDEVENT_apuframesequencer,
+                         m_lastTime + eFrameSequencerPeriod);
+}
+
+// =================================================================================================
+
+void Apu::setMode(const ApuMode mode)
+{
+    const uint64_t now = m_scheduler.getNow();
+    runUntil(now);
+
+    if ((m_mode == ApuMode::eAPUMODE_statusonly) && (mode == ApuMode::eAPUMODE_synthesis))
+    {
+        // The waveforms stood still: restart them and the synthesis from now on.
+        for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+        {
+            m_channels[channelIdx].nextStep =
+                now + getStepPeriod(static_cast<ChannelIdx>(channelIdx));
+        }
+    }
+
+    m_mode = mode;
+
+    restartSynthesis(now);
+}
+
+// =================================================================================================
+
+void Apu::setSynthesisPaused(const bool paused)
+{
+    // Everything up to now belongs to the samples kept while paused.
+    runUntil(m_scheduler.getNow());
+
+    m_synthesisPaused = paused;
+}
+
+// =================================================================================================
+
+void Apu::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_apu, eStateVersion);
+
+    writer.write(m_poweredOn);
+    writer.write(m_channels);
+    writer.write(m_registers);
+    writer.write(m_waveRAM);
+    writer.write(m_frameSequencerStep);
+    writer.write(m_lastTime);
+    writer.write(m_sweepTimer);
+    writer.write(m_sweepEnabled);
+    writer.write(m_sweepFrequency);
+    writer.write(m_lfsr);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Apu::loadState(StateReader& reader)
+{
+    if (reader.openSection(savestate::eSECTION_apu) == false)
+    {
+        return false;
+    }
+
+    const bool loaded = reader.read(m_poweredOn) && reader.read(m_channels) &&
+                        reader.read(m_registers) && reader.read(m_waveRAM) &&
+                        reader.read(m_frameSequencerStep) && reader.read(m_lastTime) &&
+                        reader.read(m_sweepTimer) && reader.read(m_sweepEnabled) &&
+                        reader.read(m_sweepFrequency) && reader.read(m_lfsr);
+
+    // The samples of the previous timeline are dropped, the mixer starts again from silence.
+    if (m_synthesisPaused == false)
+    {
+        restartSynthesis(m_lastTime);
+    }
+
+    return loaded;
+}
+
+// =================================================================================================
+
+uint8_t Apu::readRegister(const uint16_t address) const
+{
+    if (address >= HardwareIORegisters::eIOREG_wavestart)
+    {
+        return m_waveRAM[address - HardwareIORegisters::eIOREG_wavestart];
+    }
+
+    const uint8_t reg = static_cast<uint8_t>(address - HardwareIORegisters::eIOREG_nr10);
+    if (address == HardwareIORegisters::eIOREG_nr52)
+    {
+        uint8_t status = eReadMasks[reg] | ((m_poweredOn == true) ? 0x80 : 0x00);
+        for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+        {
+            status |= (m_channels[channelIdx].enabled == true) ? (1 << channelIdx) : 0;
+        }
+
+        return status;
+    }
+
+    return m_registers[reg] | eReadMasks[reg];
+}
+
+// =================================================================================================
+
+void Apu::writeRegister(const uint16_t address, const uint8_t byte)
+{
+    const uint64_t now = m_scheduler.getNow();
+    runUntil(now);
+
+    if (address >= HardwareIORegisters::eIOREG_wavestart)
+    {
+        m_waveRAM[address - HardwareIORegisters::eIOREG_wavestart] = byte;
+        return;
+    }
+
+    if (address == HardwareIORegisters::eIOREG_nr52)
+    {
+        const bool powerOn = (byte & 0x80) != 0;
+        if ((m_poweredOn == true) && (powerOn == false))
+        {
+            powerOff(now);
+        }
+        else if ((m_poweredOn == false) && (powerOn == true))
+        {
+            m_frameSequencerStep = 0;
+        }
+        m_poweredOn = powerOn;
+
+        return;
+    }
+
+    // The registers are read only while the APU is off.
+    if (m_poweredOn == false)
+    {
+        return;
+    }
+
+    const uint8_t reg = static_cast<uint8_t>(address - HardwareIORegisters::eIOREG_nr10);
+    m_registers[reg] = byte;
+
+    switch (address)
+    {
+    case HardwareIORegisters::eIOREG_nr50:
+    case HardwareIORegisters::eIOREG_nr51: updateMixer(now); break;
+
+    default:
+        if (address < HardwareIORegisters::eIOREG_nr50)
+        {
+            writeChannelRegister(static_cast<ChannelIdx>(reg / 5), reg % 5, byte);
+        }
+        break;
+    }
+}
+
+// =================================================================================================
+
+void Apu::writeChannelRegister(const ChannelIdx channelIdx, const uint8_t reg, const uint8_t byte)
+{
+    const uint64_t now = m_scheduler.getNow();
+    Channel& channel = m_channels[channelIdx];
+
+    switch (reg)
+    {
+    case 0:
+        if (channelIdx == eCHANNEL_wave)
+        {
+            channel.dacEnabled = (byte & 0x80) != 0;
+            if (channel.dacEnabled == false)
+            {
+                disableChannel(channelIdx, now);
+            }
+        }
+        break;
+
+    case 1:
+        if (channelIdx == eCHANNEL_wave)
+        {
+            channel.length = 256 - byte;
+        }
+        else
+        {
+            channel.length = 64 - (byte & 0x3F);
+        }
+        break;
+
+    case 2:
+        if (channelIdx == eCHANNEL_wave)
+        {
+            setOutput(channelIdx, now, computeOutput(channelIdx));
+        }
+        else
+        {
+            channel.envelopeVolume = byte >> 4;
+            channel.envelopeIncrease = (byte & 0x08) != 0;
+            channel.envelopePeriod = byte & 0x07;
+            channel.dacEnabled = (byte & 0xF8) != 0;
+            if (channel.dacEnabled == false)
+            {
+                disableChannel(channelIdx, now);
+            }
+        }
+        break;
+
+    case 3:
+        if (channelIdx != eCHANNEL_noise)
+        {
+            channel.frequency = (channel.frequency & 0x0700) | byte;
+        }
+        break;
+
+    case 4:
+        if (channelIdx != eCHANNEL_noise)
+        {
+            channel.frequency = (channel.frequency & 0x00FF) | ((byte & 0x07) << 8);
+        }
+        channel.lengthEnabled = (byte & 0x40) != 0;
+        if ((byte & 0x80) != 0)
+        {
+            trigger(channelIdx);
+        }
+        break;
+    }
+}
+
+// =================================================================================================
+
+void Apu::trigger(const ChannelIdx channelIdx)
+{
+    const uint64_t now = m_scheduler.getNow();
+    Channel& channel = m_channels[channelIdx];
+
+    channel.enabled = channel.dacEnabled;
+    if (channel.length == 0)
+    {
+        channel.length = (channelIdx == eCHANNEL_wave) ? 256 : 64;
+    }
+
+    channel.volume = channel.envelopeVolume;
+    channel.envelopeTimer = channel.envelopePeriod;
+    channel.position = 0;
+    channel.nextStep = now + getStepPeriod(channelIdx);
+
+    if (channelIdx == eCHANNEL_square1)
+    {
+        const uint8_t nr10 = getRegister(HardwareIORegisters::eIOREG_nr10);
+        const uint8_t sweepPeriod = (nr10 >> 4) & 0x07;
+        const uint8_t sweepShift = nr10 & 0x07;
+
+        m_sweepFrequency = channel.frequency;
+        m_sweepTimer = (sweepPeriod != 0) ? sweepPeriod : 8;
+        m_sweepEnabled = (sweepPeriod != 0) || (sweepShift != 0);
+        if ((sweepShift != 0) && (computeSweepFrequency() > 2047))
+        {
+            channel.enabled = false;
+        }
+    }
+    else if (channelIdx == eCHANNEL_noise)
+    {
+        m_lfsr = 0x7FFF;
+    }
+
+    setOutput(channelIdx, now, computeOutput(channelIdx));
+}
+
+// =================================================================================================
+
+void Apu::runUntil(const uint64_t time)
+{
+    if (time <= m_lastTime)
+    {
+        return;
+    }
+
+    if (isSynthesizing() == false)
+    {
+        m_lastTime = time;
+        return;
+    }
+
+    for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+    {
+        runChannel(static_cast<ChannelIdx>(channelIdx), time);
+    }
+
+    m_lastTime = time;
+}
+
+// =================================================================================================
+
+void Apu::runChannel(const ChannelIdx channelIdx, const uint64_t time)
+{
+    Channel& channel = m_channels[channelIdx];
+    if (channel.nextStep > time)
+    {
+        return;
+    }
+
+    const uint32_t period = getStepPeriod(channelIdx);
+
+    // A silent channel's waveform moves without any audible change: skip the steps at once.
+    const bool waveMuted = (getRegister(HardwareIORegisters::eIOREG_nr32) & 0x60) == 0;
+    const bool muted = (channelIdx == eCHANNEL_wave) ? waveMuted : (channel.volume == 0);
+    const bool silent = (channel.enabled == false) || (muted == true);
+    if ((silent == true) && (channelIdx != eCHANNEL_noise))
+    {
+        const uint64_t steps = ((time - channel.nextStep) / period) + 1;
+        channel.position = static_cast<uint8_t>((channel.position + steps) %
+                                                ((channelIdx == eCHANNEL_wave) ? 32 : 8));
+        channel.nextStep += steps * period;
+        return;
+    }
+
+    if ((silent == true) && (channel.enabled == false))
+    {
+        // The LFSR is reset on trigger, its state does not matter while the channel is off.
+        channel.nextStep += (((time - channel.nextStep) / period) + 1) * period;
+        return;
+    }
+
+    while (channel.nextStep <= time)
+    {
+        switch (channelIdx)
+        {
+        case eCHANNEL_square1:
+        case eCHANNEL_square2: channel.position = (channel.position + 1) & 0x07; break;
+        case eCHANNEL_wave: channel.position = (channel.position + 1) & 0x1F; break;
+
+        case eCHANNEL_noise:
+        {
+            const uint16_t feedback = (m_lfsr ^ (m_lfsr >> 1)) & 0x01;
+            m_lfsr = (m_lfsr >> 1) | (feedback << 14);
+            // 7 bits mode.
+            if ((getRegister(HardwareIORegisters::eIOREG_nr43) & 0x08) != 0)
+            {
+                m_lfsr = (m_lfsr & ~0x0040) | (feedback << 6);
+            }
+            break;
+        }
+
+        default: break;
+        }
+
+        const uint8_t output = computeOutput(channelIdx);
+        if (output != channel.output)
+        {
+            setOutput(channelIdx, channel.nextStep, output);
+        }
+
+        channel.nextStep += period;
+    }
+}
+
+// =================================================================================================
+
+void Apu::stepFrameSequencer(const uint64_t deadline)
+{
+    runUntil(deadline);
+
+    if (m_poweredOn == true)
+    {
+        if ((m_frameSequencerStep & 0x01) == 0)
+        {
+            clockLengths();
+        }
+        if ((m_frameSequencerStep == 2) || (m_frameSequencerStep == 6))
+        {
+            clockSweep();
+        }
+        if (m_frameSequencerStep == 7)
+        {
+            clockEnvelopes();
+        }
+    }
+    m_frameSequencerStep = (m_frameSequencerStep + 1) & 0x07;
+
+    if (isSynthesizing() == true)
+    {
+        flushSamples(deadline);
+    }
+
+    m_scheduler.schedule(SchedulerEvent::eSCHEDEVENT_apuframesequencer,
+                         deadline + eFrameSequencerPeriod);
+}
+
+// =================================================================================================
+
+void Apu::clockLengths()
+{
+    for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+    {
+        Channel& channel = m_channels[channelIdx];
+        if ((channel.lengthEnabled == true) && (channel.length > 0))
+        {
+            --channel.length;
+            if (channel.length == 0)
+            {
+                disableChannel(static_cast<ChannelIdx>(channelIdx), m_lastTime);
+            }
+        }
+    }
+}
+
+// =================================================================================================
+
+void Apu::clockSweep()
+{
+    if (m_sweepTimer > 0)
+    {
+        --m_sweepTimer;
+    }
+    if (m_sweepTimer > 0)
+    {
+        return;
+    }
+
+    const uint8_t nr10 = getRegister(HardwareIORegisters::eIOREG_nr10);
+    const uint8_t sweepPeriod = (nr10 >> 4) & 0x07;
+    m_sweepTimer = (sweepPeriod != 0) ? sweepPeriod : 8;
+
+    if ((m_sweepEnabled == false) || (sweepPeriod == 0))
+    {
+        return;
+    }
+
+    const uint16_t frequency = computeSweepFrequency();
+    if (frequency > 2047)
+    {
+        disableChannel(eCHANNEL_square1, m_lastTime);
+    }
+    else if ((nr10 & 0x07) != 0)
+    {
+        m_sweepFrequency = frequency;
+        m_channels[eCHANNEL_square1].frequency = frequency;
+
+        // The new frequency is checked for overflow again, without being used.
+        if (computeSweepFrequency() > 2047)
+        {
+            disableChannel(eCHANNEL_square1, m_lastTime);
+        }
+    }
+}
+
+// =================================================================================================
+
+void Apu::clockEnvelopes()
+{
+    for (const ChannelIdx channelIdx : {eCHANNEL_square1, eCHANNEL_square2, eCHANNEL_noise})
+    {
+        Channel& channel = m_channels[channelIdx];
+        if (channel.envelopePeriod == 0)
+        {
+            continue;
+        }
+
+        if (channel.envelopeTimer > 0)
+        {
+            --channel.envelopeTimer;
+        }
+        if (channel.envelopeTimer > 0)
+        {
+            continue;
+        }
+
+        channel.envelopeTimer = channel.envelopePeriod;
+        if ((channel.envelopeIncrease == true) && (channel.volume < 15))
+        {
+            ++channel.volume;
+        }
+        else if ((channel.envelopeIncrease == false) && (channel.volume > 0))
+        {
+            --channel.volume;
+        }
+
+        setOutput(channelIdx, m_lastTime, computeOutput(channelIdx));
+    }
+}
+
+// =================================================================================================
+
+uint16_t Apu::computeSweepFrequency() const
+{
+    const uint8_t nr10 = getRegister(HardwareIORegisters::eIOREG_nr10);
+    const uint16_t delta = m_sweepFrequency >> (nr10 & 0x07);
+
+    return ((nr10 & 0x08) != 0) ? (m_sweepFrequency - delta) : (m_sweepFrequency + delta);
+}
+
+// =================================================================================================
+
+uint32_t Apu::getStepPeriod(const ChannelIdx channelIdx) const
+{
+    switch (channelIdx)
+    {
+    case eCHANNEL_square1:
+    case eCHANNEL_square2: return (2048 - m_channels[channelIdx].frequency) * 4;
+    case eCHANNEL_wave: return (2048 - m_channels[channelIdx].frequency) * 2;
+
+    default:
+    {
+        const uint8_t nr43 = getRegister(HardwareIORegisters::eIOREG_nr43);
+        return static_cast<uint32_t>(eNoiseDivisors[nr43 & 0x07]) << (nr43 >> 4);
+    }
+    }
+}
+
+// =================================================================================================
+
+uint8_t Apu::computeOutput(const ChannelIdx channelIdx) const
+{
+    const Channel& channel = m_channels[channelIdx];
+    if (channel.enabled == false)
+    {
+        return 0;
+    }
+
+    switch (channelIdx)
+    {
+    case eCHANNEL_square1:
+    case eCHANNEL_square2:
+    {
+        const uint8_t duty = m_registers[(channelIdx * 5) + 1] >> 6;
+        return (((eDutyPatterns[duty] >> channel.position) & 0x01) != 0) ? channel.volume : 0;
+    }
+
+    case eCHANNEL_wave:
+    {
+        // Volume codes: mute, 100%, 50%, 25%.
+        const uint8_t volumeCode = (getRegister(HardwareIORegisters::eIOREG_nr32) >> 5) & 3;
+        if (volumeCode == 0)
+        {
+            return 0;
+        }
+
+        const uint8_t samples = m_waveRAM[channel.position / 2];
+        const uint8_t sample = ((channel.position & 0x01) == 0) ? (samples >> 4) : (samples & 0x0F);
+        return sample >> (volumeCode - 1);
+    }
+
+    default: return ((m_lfsr & 0x01) == 0) ? channel.volume : 0;
+    }
+}
+
+// =================================================================================================
+
+void Apu::setOutput(const ChannelIdx channelIdx, const uint64_t time, const uint8_t output)
+{
+    Channel& channel = m_channels[channelIdx];
+    channel.output = output;
+
+    if (isSynthesizing() == false)
+    {
+        return;
+    }
+
+    const uint8_t nr50 = getRegister(HardwareIORegisters::eIOREG_nr50);
+    const uint8_t nr51 = getRegister(HardwareIORegisters::eIOREG_nr51);
+
+    // Side 0 is the left one (NR51 high nibble, NR50 bits 4-6).
+    for (uint8_t side = 0; side < 2; ++side)
+    {
+        const uint8_t shift = (side == 0) ? 4 : 0;
+        const bool panned = ((nr51 >> (channelIdx + shift)) & 0x01) != 0;
+        const int32_t amplitude = (panned == true) ? output * (((nr50 >> shift) & 0x07) + 1) : 0;
+
+        const int32_t delta = amplitude - channel.amplitudes[side];
+        if (delta != 0)
+        {
+            channel.amplitudes[side] = amplitude;
+            m_blips[side].addDelta(static_cast<uint32_t>(time - m_frameStart),
+                                   delta * eAmplitudeScale);
+        }
+    }
+}
+
+// =================================================================================================
+
+void Apu::updateMixer(const uint64_t time)
+{
+    for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+    {
+        setOutput(static_cast<ChannelIdx>(channelIdx), time, m_channels[channelIdx].output);
+    }
+}
+
+// =================================================================================================
+
+void Apu::restartSynthesis(const uint64_t time)
+{
+    for (BlipBuffer& blip : m_blips)
+    {
+        blip.clear();
+    }
+    m_frameStart = time;
+
+    for (Channel& channel : m_channels)
+    {
+        channel.amplitudes = {0, 0};
+    }
+
+    updateMixer(time);
+}
+
+// =================================================================================================
+
+void Apu::disableChannel(const ChannelIdx channelIdx, const uint64_t time)
+{
+    m_channels[channelIdx].enabled = false;
+    setOutput(channelIdx, time, 0);
+}
+
+// =================================================================================================
+
+void Apu::flushSamples(const uint64_t time)
+{
+    for (BlipBuffer& blip : m_blips)
+    {
+        blip.endFrame(static_cast<uint32_t>(time - m_frameStart));
+    }
+    m_frameStart = time;
+
+    const uint32_t framesCount = m_blips[0].readSamples(m_samples.data(), eMaxSamplesPerStep, 2);
+    m_blips[1].readSamples(m_samples.data() + 1, eMaxSamplesPerStep, 2);
+
+    m_output.push(m_samples.data(), framesCount);
+}
+
+// =================================================================================================
+
+void Apu::powerOff(const uint64_t time)
+{
+    for (uint8_t channelIdx = 0; channelIdx < eCHANNEL_count; ++channelIdx)
+    {
+        disableChannel(static_cast<ChannelIdx>(channelIdx), time);
+    }
+
+    m_registers.fill(0);
+    m_channels = {};
+    m_sweepEnabled = false;
+}
@@ -0,0 +1,241 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      apu.h
+///
+/// \brief     Emulation of the Game Boy's Audio Processing Unit.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef APU_H_
+#define APU_H_
+
+#include "mmu.h"
+#include "scheduler.h"
+#include "blipbuffer.h"
+#include "audioringbuffer.h"
+#include "savestate.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// \brief What the APU emulates.
+enum class ApuMode : uint8_t
+{
+    eAPUMODE_synthesis,  ///< Everything, the samples are synthesized.
+    eAPUMODE_statusonly  ///< Only what the games can read: length counters, sweep, NR52 status.
+};
+
+/// \brief Emulation of the Game Boy's Audio Processing Unit.
+///
+/// The channels are not stepped on every clock: they catch up with the master clock when one of
+/// their registers is accessed and on every frame sequencer step (512 Hz), a scheduled event.
+/// Catching up only visits the clocks where a channel's waveform moves, and each change of its
+/// output level goes to a band-limited synthesis buffer. On every frame sequencer step the
+/// completed stereo samples are pushed into a lock-free ring buffer drained by the audio output.
+class Apu
+{
+public:
+    enum : uint32_t
+    {
+        eClockRate = 4194304,  ///< Clocks per second.
+        eSampleRate = 48000    ///< Default output sample rate.
+    };
+
+    /// \brief Constructor.
+    ///
+    /// \param mmu memory management unit routing the sound registers to the APU.
+    /// \param scheduler master clock and events queue.
+    /// \param sampleRate output sample rate in Hz.
+    Apu(Mmu& mmu, Scheduler& scheduler, const uint32_t sampleRate = eSampleRate);
+
+    Apu(const Apu&) = delete;
+    Apu& operator=(const Apu&) = delete;
+
+    /// \brief Select what the APU emulates.
+    ///
+    /// In status only mode the waveforms are not stepped and no sample is produced, but the
+    /// registers, the length counters, the envelopes and the sweep behave the same, so the
+    /// games polling NR52 see no difference.
+    void setMode(const ApuMode mode);
+
+    /// \brief Get what the APU emulates.
+    ApuMode getMode() const { return m_mode; }
+
+    /// \brief Stop or resume the synthesis without restarting it (run-ahead).
+    ///
+    /// While paused the APU behaves as in status only mode and the pending samples are kept.
+    /// The state saved right after pausing must be loaded back before resuming.
+    ///
+    /// \param paused true to stop the synthesis, false to resume it.
+    void setSynthesisPaused(const bool paused);
+
+    /// \brief Write the APU state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the APU state.
+    ///
+    /// The synthesis starts again from silence, unless it is paused: the state is then the one
+    /// saved when it was paused and the synthesis goes on seamlessly.
+    ///
+    /// \return true if the state holds the APU section, false otherwise.
+    bool loadState(StateReader& reader);
+
+    /// \brief Get the queue receiving the interleaved left/right samples.
+    AudioRingBuffer& getOutput() { return m_output; }
+
+private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    /// \brief Sound channels.
+    enum ChannelIdx : uint8_t
+    {
+        eCHANNEL_square1,  ///< Square wave with frequency sweep.
+        eCHANNEL_square2,  ///< Square wave.
+        eCHANNEL_wave,     ///< Custom 4 bits waveform.
+        eCHANNEL_noise,    ///< Pseudo random noise.
+        eCHANNEL_count
+    };
+
+    /// \brief State of one sound channel.
+    struct Channel
+    {
+        bool enabled = false;        ///< Is the channel playing (NR52 status bit)?
+        bool dacEnabled = false;     ///< Is the channel's DAC powered?
+        bool lengthEnabled = false;  ///< Does the length counter stop the channel?
+        uint16_t length = 0;         ///< Length counter.
+
+        uint8_t volume = 0;             ///< Current volume (0-15).
+        uint8_t envelopeVolume = 0;     ///< Volume loaded on trigger.
+        bool envelopeIncrease = false;  ///< Direction of the envelope.
+        uint8_t envelopePeriod = 0;     ///< Envelope steps period (0 = stopped).
+        uint8_t envelopeTimer = 0;      ///< Envelope steps before the next volume change.
+
+        uint16_t frequency = 0;  ///< 11 bits frequency value.
+        uint64_t nextStep = 0;   ///< Clock of the next waveform step.
+        uint8_t position = 0;    ///< Position in the duty cycle or the wave pattern.
+        uint8_t output = 0;      ///< Current digital output level (0-15).
+
+        std::array<int32_t, 2> amplitudes = {0, 0};  ///< Output sent to each side of the mixer.
+    };
+
+    /// \brief Read a sound register.
+    uint8_t readRegister(const uint16_t address) const;
+
+    /// \brief Write a sound register.
+    void writeRegister(const uint16_t address, const uint8_t byte);
+
+    /// \brief Get the raw value of a sound register.
+    uint8_t getRegister(const uint16_t address) const
+    {
+        return m_registers[address - HardwareIORegisters::eIOREG_nr10];
+    }
+
+    /// \brief Write one of the NRx0-NRx4 registers of a channel.
+    void writeChannelRegister(const ChannelIdx channelIdx, const uint8_t reg, const uint8_t byte);
+
+    /// \brief Start playing a channel.
+    void trigger(const ChannelIdx channelIdx);
+
+    /// \brief Catch up every channel with a master clock value.
+    void runUntil(const uint64_t time);
+
+    /// \brief Catch up a channel with a master clock value.
+    void runChannel(const ChannelIdx channelIdx, const uint64_t time);
+
+    /// \brief Frame sequencer step: length counters, sweep, envelopes and samples output.
+    void stepFrameSequencer(const uint64_t deadline);
+
+    /// \brief Clock the length counters (256 Hz).
+    void clockLengths();
+
+    /// \brief Clock channel 1's frequency sweep (128 Hz).
+    void clockSweep();
+
+    /// \brief Clock the volume envelopes (64 Hz).
+    void clockEnvelopes();
+
+    /// \brief Compute the next frequency of channel 1's sweep.
+    ///
+    /// \return the new frequency, above 2047 if it overflows (which stops the channel).
+    uint16_t computeSweepFrequency() const;
+
+    /// \brief Get the clocks between two waveform steps of a channel.
+    uint32_t getStepPeriod(const ChannelIdx channelIdx) const;
+
+    /// \brief Compute the digital output level of a channel at its current position.
+    uint8_t computeOutput(const ChannelIdx channelIdx) const;
+
+    /// \brief Change the output level of a channel and send the change to the mixer.
+    void setOutput(const ChannelIdx channelIdx, const uint64_t time, const uint8_t output);
+
+    /// \brief Check if the samples are produced.
+    bool isSynthesizing() const
+    {
+        return (m_mode == ApuMode::eAPUMODE_synthesis) && (m_synthesisPaused == false);
+    }
+
+    /// \brief Send the level of every channel to the mixer again (volume or panning change).
+    void updateMixer(const uint64_t time);
+
+    /// \brief Drop the pending samples and start the synthesis again from silence.
+    void restartSynthesis(const uint64_t time);
+
+    /// \brief Stop a channel.
+    void disableChannel(const ChannelIdx channelIdx, const uint64_t time);
+
+    /// \brief Move the completed samples to the output queue.
+    void flushSamples(const uint64_t time);
+
+    /// \brief Reset all the registers when the APU is powered off.
+    void powerOff(const uint64_t time);
+
+    Scheduler& m_scheduler;  ///< Master clock and events queue.
+    ApuMode m_mode;          ///< What is emulated.
+    bool m_synthesisPaused;  ///< Is the synthesis paused (run-ahead)?
+
+    bool m_poweredOn;                                ///< NR52 bit 7.
+    std::array<Channel, eCHANNEL_count> m_channels;  ///< Sound channels.
+    std::array<uint8_t, 0x20> m_registers;           ///< Raw NR10-NR52 values.
+    std::array<uint8_t, 0x10> m_waveRAM;             ///< Wave pattern RAM.
+    uint8_t m_frameSequencerStep;                    ///< Next frame sequencer step (0-7).
+    uint64_t m_lastTime;                             ///< Clock the channels run until.
+
+    // Channel 1's frequency sweep.
+    uint8_t m_sweepTimer;       ///< Sweep steps before the next frequency change.
+    bool m_sweepEnabled;        ///< Is the sweep running?
+    uint16_t m_sweepFrequency;  ///< Shadow frequency of the sweep.
+
+    // Channel 4's noise generator.
+    uint16_t m_lfsr;  ///< Linear feedback shift register.
+
+    // Output.
+    uint64_t m_frameStart;              ///< Clock at which the synthesis frame started.
+    std::array<BlipBuffer, 2> m_blips;  ///< Left and right band-limited synthesis.
+    std::vector<int16_t> m_samples;     ///< Interleaved samples moved to the output queue.
+    AudioRingBuffer m_output;           ///< Samples waiting for the audio output.
+};
+
+#endif /* APU_H_ */
@@ -0,0 +1,88 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      audioringbuffer.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "audioringbuffer.h"
+
+#include <algorithm>
+
+AudioRingBuffer::AudioRingBuffer(const uint32_t capacity)
+{
+    uint32_t roundedCapacity = 1;
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity <<= 1;
+    }
+
+    m_mask = roundedCapacity - 1;
+    m_samples.resize(roundedCapacity * 2);
+}
+
+// =================================================================================================
+
+uint32_t AudioRingBuffer::push(const int16_t* samples, const uint32_t framesCount)
+{
+    const uint64_t head = m_head.load(std::memory_order_relaxed);
+    const uint64_t tail = m_tail.load(std::memory_order_acquire);
+    const uint32_t freeFrames = (m_mask + 1) - static_cast<uint32_t>(head - tail);
+    const uint32_t pushedFrames = std::min(framesCount, freeFrames);
+
+    // Copy in up to two parts when wrapping around the end of the buffer.
+    const uint32_t start = static_cast<uint32_t>(head) & m_mask;
+    const uint32_t firstPart = std::min(pushedFrames, (m_mask + 1) - start);
+    std::copy(samples, samples + (firstPart * 2), m_samples.begin() + (start * 2));
+    std::copy(samples + (firstPart * 2), samples + (pushedFrames * 2), m_samples.begin());
+
+    m_head.store(head + pushedFrames, std::memory_order_release);
+
+    if (pushedFrames < framesCount)
+    {
+        m_droppedFrames.fetch_add(framesCount - pushedFrames, std::memory_order_relaxed);
+    }
+
+    return pushedFrames;
+}
+
+// =================================================================================================
+
+uint32_t AudioRingBuffer::pop(int16_t* samples, const uint32_t framesCount)
+{
+    const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    const uint32_t poppedFrames = std::min(framesCount, static_cast<uint32_t>(head - tail));
+
+    const uint32_t start = static_cast<uint32_t>(tail) & m_mask;
+    const uint32_t firstPart = std::min(poppedFrames, (m_mask + 1) - start);
+    std::copy(m_samples.begin() + (start * 2),
+              m_samples.begin() + ((start + firstPart) * 2),
+              samples);
+    std::copy(m_samples.begin(),
+              m_samples.begin() + ((poppedFrames - firstPart) * 2),
+              samples + (firstPart * 2));
+
+    m_tail.store(tail + poppedFrames, std::memory_order_release);
+
+    return poppedFrames;
+}
@@ -0,0 +1,85 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      audioringbuffer.h
+///
+/// \brief     Lock-free queue of audio samples between the emulation and the audio output.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef AUDIORINGBUFFER_H_
+#define AUDIORINGBUFFER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/// \brief Lock-free single producer, single consumer queue of stereo 16 bits samples.
+///
+/// The emulation thread pushes the samples generated by the APU, an audio thread drains them.
+/// Neither side ever waits: the samples that do not fit are dropped.
+class AudioRingBuffer
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param capacity stereo frames the queue holds, rounded up to a power of 2.
+    explicit AudioRingBuffer(const uint32_t capacity);
+
+    /// \brief Push stereo frames (producer side).
+    ///
+    /// \param samples interleaved left/right samples.
+    /// \param framesCount number of stereo frames.
+    ///
+    /// \return number of frames pushed, the others were dropped.
+    uint32_t push(const int16_t* samples, const uint32_t framesCount);
+
+    /// \brief Pop stereo frames (consumer side).
+    ///
+    /// \param[out] samples receives the interleaved left/right samples.
+    /// \param framesCount maximum number of stereo frames to pop.
+    ///
+    /// \return number of frames popped.
+    uint32_t pop(int16_t* samples, const uint32_t framesCount);
+
+    /// \brief Get the number of frames waiting in the queue.
+    uint32_t getFramesAvailable() const
+    {
+        return static_cast<uint32_t>(m_head.load(std::memory_order_acquire) -
+                                     m_tail.load(std::memory_order_acquire));
+    }
+
+    /// \brief Get the number of frames dropped because the queue was full.
+    uint64_t getDroppedFramesCount() const
+    {
+        return m_droppedFrames.load(std::memory_order_relaxed);
+    }
+
+private:
+    uint32_t m_mask;                 ///< Capacity - 1.
+    std::vector<int16_t> m_samples;  ///< Interleaved left/right samples.
+
+    alignas(64) std::atomic<uint64_t> m_head{0};  ///< Frames pushed, written by the producer.
+    alignas(64) std::atomic<uint64_t> m_tail{0};  ///< Frames popped, written by the consumer.
+    std::atomic<uint64_t> m_droppedFrames{0};     ///< Frames that did not fit.
+};
+
+#endif /* AUDIORINGBUFFER_H_ */
@@ -0,0 +1,133 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      blipbuffer.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "blipbuffer.h"
+
+#include "utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BlipBuffer::BlipBuffer(const uint32_t clockRate, const uint32_t sampleRate,
+                       const uint32_t maxSamples) :
+    m_factor((static_cast<uint64_t>(sampleRate) << eFracBits) / clockRate),
+    m_offset(0), m_integrator(0), m_buffer(maxSamples + eTaps, 0)
+{
+    // Blackman windowed sinc with a cutoff slightly under the output Nyquist frequency.
+    constexpr double pi = 3.14159265358979323846;
+    constexpr double cutoff = 0.9;
+    for (uint32_t phase = 0; phase < ePhases; ++phase)
+    {
+        std::array<double, eTaps> impulse;
+        double sum = 0.0;
+        for (uint32_t tap = 0; tap < eTaps; ++tap)
+        {
+            const double x = (static_cast<double>(tap) - (eTaps / 2) + 1) -
+                             (static_cast<double>(phase) / ePhases);
+            const double sinc = (x == 0.0) ? 1.0 : std::sin(pi * cutoff * x) / (pi * cutoff * x);
+            const double w = (x + (eTaps / 2)) / eTaps;
+            const double window = 0.42 - (0.5 * std::cos(2.0 * pi * w)) +
+                                  (0.08 * std::cos(4.0 * pi * w));
+            impulse[tap] = sinc * window;
+            sum += impulse[tap];
+        }
+
+        // Normalize, then put the rounding error on the center tap so that every step ends
+        // exactly at its delta.
+        int32_t total = 0;
+        for (uint32_t tap = 0; tap < eTaps; ++tap)
+        {
+            m_kernel[phase][tap] =
+                static_cast<int32_t>(std::lround(impulse[tap] / sum * (1 << eDeltaBits)));
+            total += m_kernel[phase][tap];
+        }
+        m_kernel[phase][(eTaps / 2) - 1] += (1 << eDeltaBits) - total;
+    }
+}
+
+// =================================================================================================
+
+void BlipBuffer::addDelta(const uint32_t time, const int32_t delta)
+{
+    const uint64_t position = m_offset + (time * m_factor);
+    const uint32_t sampleIdx = static_cast<uint32_t>(position >> eFracBits);
+    const uint32_t phase =
+        static_cast<uint32_t>(position >> (eFracBits - ePhaseBits)) & (ePhases - 1);
+
+    CBASSERT(sampleIdx + eTaps <= m_buffer.size(), "Blip buffer overflow");
+
+    int32_t* const out = m_buffer.data() + sampleIdx;
+    const std::array<int32_t, eTaps>& kernel = m_kernel[phase];
+    for (uint32_t tap = 0; tap < eTaps; ++tap)
+    {
+        out[tap] += kernel[tap] * delta;
+    }
+}
+
+// =================================================================================================
+
+void BlipBuffer::endFrame(const uint32_t duration)
+{
+    m_offset += duration * m_factor;
+}
+
+// =================================================================================================
+
+uint32_t BlipBuffer::readSamples(int16_t* out, const uint32_t count, const uint32_t stride)
+{
+    const uint32_t samplesCount = std::min(count, getSamplesAvailable());
+
+    int32_t integrator = m_integrator;
+    for (uint32_t idx = 0; idx < samplesCount; ++idx)
+    {
+        integrator += m_buffer[idx];
+        const int32_t sample = integrator >> eDeltaBits;
+        out[idx * stride] = static_cast<int16_t>(
+            std::clamp<int32_t>(sample, std::numeric_limits<int16_t>::min(),
+                                std::numeric_limits<int16_t>::max()));
+
+        // High-pass: slowly bring the level back to 0.
+        integrator -= sample << (eDeltaBits - eBassShift);
+    }
+    m_integrator = integrator;
+
+    // Keep the deltas of the samples that are not complete yet.
+    std::copy(m_buffer.begin() + samplesCount, m_buffer.end(), m_buffer.begin());
+    std::fill(m_buffer.end() - samplesCount, m_buffer.end(), 0);
+    m_offset -= static_cast<uint64_t>(samplesCount) << eFracBits;
+
+    return samplesCount;
+}
+
+// =================================================================================================
+
+void BlipBuffer::clear()
+{
+    m_offset = 0;
+    m_integrator = 0;
+    std::fill(m_buffer.begin(), m_buffer.end(), 0);
+}
@@ -0,0 +1,97 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      blipbuffer.h
+///
+/// \brief     Band-limited synthesis of square waveforms.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef BLIPBUFFER_H_
+#define BLIPBUFFER_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// \brief Band-limited synthesis of square waveforms.
+///
+/// The sound channels only report the clocks at which their output level changes (deltas).
+/// Each delta adds a band-limited step (windowed sinc) to the output samples, so the signal is
+/// resampled from the console's clock to the output rate without aliasing and without
+/// computing anything on the clocks where nothing changes.
+class BlipBuffer
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param clockRate input clock rate in Hz.
+    /// \param sampleRate output sample rate in Hz.
+    /// \param maxSamples samples that may accumulate between two reads.
+    BlipBuffer(const uint32_t clockRate, const uint32_t sampleRate, const uint32_t maxSamples);
+
+    /// \brief Add a change of the output level.
+    ///
+    /// \param time clocks since the start of the current frame.
+    /// \param delta change of the output level.
+    void addDelta(const uint32_t time, const int32_t delta);
+
+    /// \brief End the current frame, its samples become readable.
+    ///
+    /// \param duration frame duration in clocks, deltas may still be added after it.
+    void endFrame(const uint32_t duration);
+
+    /// \brief Get the number of samples ready to be read.
+    uint32_t getSamplesAvailable() const { return static_cast<uint32_t>(m_offset >> eFracBits); }
+
+    /// \brief Read and remove samples.
+    ///
+    /// \param out samples destination.
+    /// \param count maximum number of samples to read.
+    /// \param stride distance between two samples in out (2 to interleave stereo samples).
+    ///
+    /// \return number of samples read.
+    uint32_t readSamples(int16_t* out, const uint32_t count, const uint32_t stride);
+
+    /// \brief Remove all the samples and deltas.
+    void clear();
+
+private:
+    enum : uint32_t
+    {
+        eFracBits = 32,             ///< Fractional bits of the sample positions.
+        ePhaseBits = 5,             ///< Resolution of the steps' fractional positions.
+        ePhases = 1 << ePhaseBits,  ///< Number of fractional positions.
+        eTaps = 16,                 ///< Samples covered by one step.
+        eDeltaBits = 15,            ///< Fixed point precision of the steps.
+        eBassShift = 9               ///< High-pass filter strength, removes the DC offset.
+    };
+
+    uint64_t m_factor;              ///< Output samples per clock (32.32 fixed point).
+    uint64_t m_offset;              ///< Start of the current frame (32.32 fixed point).
+    int32_t m_integrator;           ///< Output level of the last read sample.
+    std::vector<int32_t> m_buffer;  ///< Accumulated steps derivatives.
+
+    /// Band-limited impulse of each phase, each sums to 1 << eDeltaBits.
+    std::array<std::array<int32_t, eTaps>, ePhases> m_kernel;
+};
+
+#endif /* BLIPBUFFER_H_ */
@@ -0,0 +1,52 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      calltracer.h
+///
+/// \brief     Observer of the routines entered and left by the CPU.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef CALLTRACER_H_
+#define CALLTRACER_H_
+
+#include <cstdint>
+
+/// \brief Observer of the routines entered and left by the CPU.
+///
+/// The CPU reports each completed CALL, RST and interrupt dispatch, and each completed RET and
+/// RETI. The stack pointer lets the tracer match the returns with their calls even when a game
+/// pops or pushes return addresses by itself.
+class CallTracer
+{
+public:
+    /// \brief A routine was entered.
+    ///
+    /// \param address routine's address.
+    /// \param stackPointer SP once the return address is pushed.
+    virtual void enterRoutine(const uint16_t address, const uint16_t stackPointer) = 0;
+
+    /// \brief A routine returned.
+    ///
+    /// \param stackPointer SP once the return address is popped.
+    virtual void leaveRoutine(const uint16_t stackPointer) = 0;
+};
+
+#endif /* CALLTRACER_H_ */
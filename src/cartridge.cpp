@@ -28,13 +28,21 @@
 
 #include <algorithm>
 
-Cartridge::Cartridge(const std::filesystem::path& cartPath)
+Cartridge::Cartridge(const std::filesystem::path& cartPath) :
+    m_ROMBanks(std::make_shared<std::vector<uint8_t>>())
 {
     parseROMFile(cartPath);
 }
 
 // =================================================================================================
 
+Cartridge::Cartridge(std::vector<uint8_t> rom) :
+    m_ROMBanks(std::make_shared<std::vector<uint8_t>>(std::move(rom)))
+{
+}
+
+// =================================================================================================
+
 void Cartridge::parseROMFile(const std::filesystem::path& cartPath)
 {
     namespace fs = std::filesystem;
@@ -42,12 +50,12 @@ void Cartridge::parseROMFile(const std::filesystem::path& cartPath)
     if ((fs::exists(cartPath) == true) && (fs::is_regular_file(cartPath) == true))
     {
         const std::uintmax_t romSize = fs::file_size(cartPath);
-        m_ROMBanks.resize(romSize);
+        m_ROMBanks->resize(romSize);
 
         {
             std::unique_ptr<FILE, decltype(&fclose)> smtROMFile(
                 std::fopen(static_cast<const std::string>(cartPath).c_str(), "rb"), &fclose);
-            fread(m_ROMBanks.data(), romSize, 1, smtROMFile.get());
+            fread(m_ROMBanks->data(), romSize, 1, smtROMFile.get());
         }
     }
 }
@@ -61,13 +69,13 @@ void Cartridge::extractROMInfo()
     // *********************************************************************************************
 
     CBLOG("Read the Cartridge's title");
-    m_cartInfo.m_title = std::string(reinterpret_cast<const char*>(&m_ROMBanks[0x0134]),
+    m_cartInfo.m_title = std::string(reinterpret_cast<const char*>(&(*m_ROMBanks)[0x0134]),
                                      0x0143 - 0x0134);
 
     // *********************************************************************************************
 
     CBLOG("Read the Cartridge's Game Boy compatibility");
-    const uint8_t cgbFlag = m_ROMBanks[0x0143];
+    const uint8_t cgbFlag = (*m_ROMBanks)[0x0143];
     if (cgbFlag == 0x80)
     {
         m_cartInfo.m_GBCOnly = false;
@@ -80,7 +88,7 @@ void Cartridge::extractROMInfo()
     // *********************************************************************************************
 
     CBLOG("Check if the Cartridge has a battery");
-    const uint8_t cartType = m_ROMBanks[0x0147];
+    const uint8_t cartType = (*m_ROMBanks)[0x0147];
     switch (cartType)
     {
     case 0x03:
@@ -101,7 +109,7 @@ void Cartridge::extractROMInfo()
     // *********************************************************************************************
 
     CBLOG("Read the Cartridge's ROM size");
-    const uint8_t romType = m_ROMBanks[0x0148];
+    const uint8_t romType = (*m_ROMBanks)[0x0148];
     if (romType >= 0 && romType <= 8)
     {
         // 32KB << Val @ 0x0148.
@@ -130,7 +138,7 @@ void Cartridge::extractROMInfo()
     // *********************************************************************************************
 
     CBLOG("Read the Cartridge's RAM size");
-    switch (m_ROMBanks[0x0149])
+    switch ((*m_ROMBanks)[0x0149])
     {
     case 0: m_cartInfo.m_ramSize = 0; break;                             // None.
     case 1: m_cartInfo.m_ramSize = cbutil::toByteValue(2_KiB); break;    // 2KB.
@@ -140,7 +148,7 @@ void Cartridge::extractROMInfo()
     case 5: m_cartInfo.m_ramSize = cbutil::toByteValue(64_KiB); break;   // 64KB.
     }
     m_cartInfo.m_ramBanksCount = m_cartInfo.m_ramSize / cbutil::toByteValue(8_KiB);
-    m_RAMBanks.reserve(m_cartInfo.m_ramBanksCount);
+    m_RAMBanks.resize(m_cartInfo.m_ramSize);
 
     CBLOG("Parsing finished!");
 }
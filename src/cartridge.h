@@ -46,6 +46,11 @@ public:
     /// \param cartPath path to the game ROM file.
     Cartridge(const std::filesystem::path& cartPath);
 
+    /// \brief Constructor.
+    ///
+    /// \param rom content of the game ROM.
+    explicit Cartridge(std::vector<uint8_t> rom);
+
     enum : uint16_t
     {
         eROMBankSize = cbutil::toByteValue(16_KiB)  ///< Each individual Rom Bank is 16KB long.
@@ -53,17 +58,28 @@ public:
 
     auto getROMBank(const uint8_t bankNum)
     {
-        CBASSERT((bankNum * eROMBankSize) < m_ROMBanks.size(),
+        CBASSERT((bankNum * eROMBankSize) < m_ROMBanks->size(),
                  "Invalid Cartridge's ROM bank selection");
 
-        using RomBanksIter = decltype(m_ROMBanks.begin());
-        return (std::make_pair<RomBanksIter, RomBanksIter>(m_ROMBanks.begin() +
+        using RomBanksIter = decltype(m_ROMBanks->begin());
+        return (std::make_pair<RomBanksIter, RomBanksIter>(m_ROMBanks->begin() +
                                                                (bankNum * (eROMBankSize + 1)),
-                                                           m_ROMBanks.begin() +
+                                                           m_ROMBanks->begin() +
                                                                (bankNum * eROMBankSize) +
                                                                eROMBankSize));
     }
 
+    /// \brief Get the cartridge's whole ROM.
+    std::vector<uint8_t>& getROM() { return *m_ROMBanks; }
+    const std::vector<uint8_t>& getROM() const { return *m_ROMBanks; }
+
+    /// \brief Check if the ROM fills the two banks mapped at power on, smaller files are no ROMs.
+    bool isROMValid() const { return m_ROMBanks->size() >= 2 * eROMBankSize; }
+
+    /// \brief Get the cartridge's RAM, empty if the cartridge has none.
+    std::vector<uint8_t>& getRAM() { return m_RAMBanks; }
+    const std::vector<uint8_t>& getRAM() const { return m_RAMBanks; }
+
     struct CartridgeInfo;
 
     const CartridgeInfo& getCartInfo() const { return m_cartInfo; }
@@ -96,7 +112,8 @@ private:
     /// \brief Extract the ROM's info from its header.
     void extractROMInfo();
 
-    std::vector<uint8_t> m_ROMBanks;
+    /// The copies of a cartridge share its ROM, the MMU never writes it.
+    std::shared_ptr<std::vector<uint8_t>> m_ROMBanks;
     std::vector<uint8_t> m_RAMBanks;
 
     CartridgeInfo m_cartInfo;
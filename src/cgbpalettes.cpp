@@ -0,0 +1,159 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      cgbpalettes.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "cgbpalettes.h"
+
+#include <algorithm>
+
+namespace
+{
+/// \brief Pack 8-bit channels into a RGBA8888 pixel (R, G, B, A bytes order in memory).
+uint32_t packRGBA(const uint32_t red, const uint32_t green, const uint32_t blue)
+{
+    return 0xFF000000 | (blue << 16) | (green << 8) | red;
+}
+
+/// \brief Build the lookup table converting every 15-bit color to RGBA8888.
+CgbPalettes::ColorLUT buildColorLUT(const ColorCorrection correction)
+{
+    CgbPalettes::ColorLUT lut;
+
+    for (uint32_t color = 0; color < lut.size(); ++color)
+    {
+        const uint32_t red = color & 0x1F;
+        const uint32_t green = (color >> 5) & 0x1F;
+        const uint32_t blue = (color >> 10) & 0x1F;
+
+        switch (correction)
+        {
+        case ColorCorrection::eCOLORCORR_none:
+            lut[color] = packRGBA((red << 3) | (red >> 2),
+                                  (green << 3) | (green >> 2),
+                                  (blue << 3) | (blue >> 2));
+            break;
+
+        case ColorCorrection::eCOLORCORR_lcd:
+            // Channels cross-talk of the CGB's LCD, scaled to 0-960 then brought back to 0-240.
+            lut[color] = packRGBA(
+                std::min<uint32_t>(960, (red * 26) + (green * 4) + (blue * 2)) >> 2,
+                std::min<uint32_t>(960, (green * 24) + (blue * 8)) >> 2,
+                std::min<uint32_t>(960, (red * 6) + (green * 4) + (blue * 22)) >> 2);
+            break;
+        }
+    }
+
+    return lut;
+}
+
+}  // namespace
+
+// =================================================================================================
+
+CgbPalettes::CgbPalettes() : m_specs{0, 0}, m_lut(&getColorLUT(ColorCorrection::eCOLORCORR_none))
+{
+    // The palettes are white at power on.
+    for (auto& memory : m_memory)
+    {
+        memory.fill(0xFF);
+    }
+
+    setColorCorrection(ColorCorrection::eCOLORCORR_none);
+}
+
+// =================================================================================================
+
+const CgbPalettes::ColorLUT& CgbPalettes::getColorLUT(const ColorCorrection correction)
+{
+    static const ColorLUT noCorrectionLUT = buildColorLUT(ColorCorrection::eCOLORCORR_none);
+    static const ColorLUT lcdCorrectionLUT = buildColorLUT(ColorCorrection::eCOLORCORR_lcd);
+
+    return (correction == ColorCorrection::eCOLORCORR_lcd) ? lcdCorrectionLUT : noCorrectionLUT;
+}
+
+// =================================================================================================
+
+void CgbPalettes::setColorCorrection(const ColorCorrection correction)
+{
+    m_lut = &getColorLUT(correction);
+
+    for (const bool obj : {false, true})
+    {
+        for (uint8_t colorIdx = 0; colorIdx < eColorsCount; ++colorIdx)
+        {
+            refreshColor(obj, colorIdx);
+        }
+    }
+}
+
+// =================================================================================================
+
+void CgbPalettes::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_palettes, eStateVersion);
+
+    writer.write(m_memory);
+    writer.write(m_specs);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool CgbPalettes::loadState(StateReader& reader)
+{
+    if ((reader.openSection(savestate::eSECTION_palettes) == false) ||
+        (reader.read(m_memory) == false) || (reader.read(m_specs) == false))
+    {
+        return false;
+    }
+
+    // The cached colors are derived from the memory.
+    for (const bool obj : {false, true})
+    {
+        for (uint8_t colorIdx = 0; colorIdx < eColorsCount; ++colorIdx)
+        {
+            refreshColor(obj, colorIdx);
+        }
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+void CgbPalettes::writeData(const bool obj, const uint8_t byte)
+{
+    const uint8_t index = m_specs[obj] & 0x3F;
+
+    m_memory[obj][index] = byte;
+    refreshColor(obj, index / 2);
+
+    // Auto increment the index if bit 7 of the specification register is set.
+    if ((m_specs[obj] & 0x80) != 0)
+    {
+        m_specs[obj] = 0x80 | ((index + 1) & 0x3F);
+    }
+}
@@ -0,0 +1,123 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      cgbpalettes.h
+///
+/// \brief     Game Boy Color BG and OBJ palettes memory.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef CGBPALETTES_H_
+#define CGBPALETTES_H_
+
+#include "utils.h"
+#include "savestate.h"
+
+#include <array>
+#include <cstdint>
+
+/// \brief Color correction curves applied when converting the CGB 15-bit colors to RGBA.
+enum class ColorCorrection : uint8_t
+{
+    eCOLORCORR_none,  ///< Plain 5-bit to 8-bit channels expansion.
+    eCOLORCORR_lcd    ///< Mimic the washed-out colors of the CGB's LCD.
+};
+
+/// \brief Representation of the CGB palettes memory (BCPS/BCPD/OCPS/OCPD).
+///
+/// Each palette memory holds 8 palettes of 4 little-endian 15-bit colors (xBBBBBGGGGGRRRRR).
+/// Every write to the palette data is converted right away into a RGBA8888 color using a 32K
+/// entries lookup table, so that the PPU resolves a pixel's color with a single table load.
+class CgbPalettes
+{
+public:
+    CgbPalettes();
+
+    enum : uint8_t
+    {
+        ePalettesCount = 8,                            ///< Palettes per palette memory.
+        eColorsCount = ePalettesCount * 4,             ///< Colors per palette memory.
+        eMemorySize = eColorsCount * sizeof(uint16_t)  ///< 64 bytes per palette memory.
+    };
+
+    /// \brief Select the color correction curve and refresh the cached colors.
+    ///
+    /// \param correction color correction curve.
+    void setColorCorrection(const ColorCorrection correction);
+
+    /// \brief Write to the BG (0xFF68) or OBJ (0xFF6A) palette specification register.
+    void writeSpecification(const bool obj, const uint8_t byte) { m_specs[obj] = byte & 0xBF; }
+
+    /// \brief Read the BG (0xFF68) or OBJ (0xFF6A) palette specification register.
+    uint8_t readSpecification(const bool obj) const { return m_specs[obj] | 0x40; }
+
+    /// \brief Write to the BG (0xFF69) or OBJ (0xFF6B) palette data register.
+    void writeData(const bool obj, const uint8_t byte);
+
+    /// \brief Read the BG (0xFF69) or OBJ (0xFF6B) palette data register.
+    uint8_t readData(const bool obj) const { return m_memory[obj][m_specs[obj] & 0x3F]; }
+
+    /// \brief Get the RGBA8888 colors of the BG palettes (palette * 4 + color number).
+    const uint32_t* getBGColors() const { return m_colors[0].data(); }
+
+    /// \brief Get the RGBA8888 colors of the OBJ palettes (palette * 4 + color number).
+    const uint32_t* getOBJColors() const { return m_colors[1].data(); }
+
+    /// \brief Write the palettes memory and the specification registers.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the palettes memory and the specification registers.
+    ///
+    /// \return true if the state holds the palettes section, false otherwise.
+    bool loadState(StateReader& reader);
+
+    using ColorLUT = std::array<uint32_t, 0x8000>;
+
+    /// \brief Get the 15-bit to RGBA8888 lookup table of a color correction curve.
+    ///
+    /// The tables are built once per process and shared by all the consoles.
+    ///
+    /// \param correction color correction curve.
+    ///
+    /// \return the lookup table.
+    static const ColorLUT& getColorLUT(const ColorCorrection correction);
+
+private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    /// \brief Convert the color stored at a palette memory index into the cached colors.
+    void refreshColor(const bool obj, const uint8_t colorIdx)
+    {
+        const uint16_t color = cbutil::combineTwoBytes(m_memory[obj][colorIdx * 2],
+                                                       m_memory[obj][(colorIdx * 2) + 1]);
+        m_colors[obj][colorIdx] = (*m_lut)[color & 0x7FFF];
+    }
+
+    std::array<std::array<uint8_t, eMemorySize>, 2> m_memory;    ///< BG and OBJ palettes memory.
+    std::array<std::array<uint32_t, eColorsCount>, 2> m_colors;  ///< BG and OBJ cached colors.
+    std::array<uint8_t, 2> m_specs;                              ///< BCPS and OCPS.
+    const ColorLUT* m_lut;                                       ///< Active lookup table.
+};
+
+#endif /* CGBPALETTES_H_ */
@@ -0,0 +1,199 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      colorboy.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "colorboy.h"
+
+#include "console.h"
+
+#include <new>
+
+static_assert(COLORBOY_MODEL_DMG == static_cast<uint32_t>(GBType::eGBTYPE_dmg), "Model mismatch");
+static_assert(COLORBOY_MODEL_CGB == static_cast<uint32_t>(GBType::eGBTYPE_cgb), "Model mismatch");
+static_assert(COLORBOY_BUTTON_RIGHT == JoypadButtons::eBUTTON_right, "Button mismatch");
+static_assert(COLORBOY_BUTTON_START == JoypadButtons::eBUTTON_start, "Button mismatch");
+static_assert(COLORBOY_FRAME_WIDTH == Ppu::eFrameWidth, "Frame size mismatch");
+static_assert(COLORBOY_FRAME_HEIGHT == Ppu::eFrameHeight, "Frame size mismatch");
+
+/// \brief The opaque console handed to the C callers.
+struct colorboy_console
+{
+    Console console;
+};
+
+namespace
+{
+/// \brief Create and power on a console, no C++ exception may cross the C interface.
+template <typename RomSource>
+colorboy_console* createConsole(const uint32_t model, RomSource&& rom)
+{
+    if ((model != COLORBOY_MODEL_DMG) && (model != COLORBOY_MODEL_CGB))
+    {
+        return nullptr;
+    }
+
+    colorboy_console* handle = new (std::nothrow)
+        colorboy_console{Console(static_cast<GBType>(model), std::forward<RomSource>(rom))};
+    if (handle == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (handle->console.isCartridgeValid() == false)
+    {
+        delete handle;
+        return nullptr;
+    }
+
+    handle->console.powerOn();
+
+    return handle;
+}
+
+}  // namespace
+
+// =================================================================================================
+
+uint32_t colorboy_abi_version(void)
+{
+    return COLORBOY_ABI_VERSION;
+}
+
+// =================================================================================================
+
+colorboy_console* colorboy_create_from_file(uint32_t model, const char* romPath)
+{
+    if (romPath == nullptr)
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        return createConsole(model, std::filesystem::path(romPath));
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+// =================================================================================================
+
+colorboy_console* colorboy_create_from_memory(uint32_t model, const uint8_t* rom, size_t romSize)
+{
+    if (rom == nullptr)
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        return createConsole(model, std::vector<uint8_t>(rom, rom + romSize));
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+// =================================================================================================
+
+void colorboy_destroy(colorboy_console* console)
+{
+    delete console;
+}
+
+// =================================================================================================
+
+int colorboy_run_frame(colorboy_console* console)
+{
+    return (console->console.runFrame() == true) ? 1 : 0;
+}
+
+// =================================================================================================
+
+int colorboy_run_cycles(colorboy_console* console, uint64_t cycles)
+{
+    return (console->console.runCycles(cycles) == true) ? 1 : 0;
+}
+
+// =================================================================================================
+
+void colorboy_set_input(colorboy_console* console, uint8_t buttons)
+{
+    console->console.setJoypadButtons(buttons);
+}
+
+// =================================================================================================
+
+const uint32_t* colorboy_framebuffer(const colorboy_console* console)
+{
+    return console->console.getFrameBuffer();
+}
+
+// =================================================================================================
+
+size_t colorboy_audio_samples(colorboy_console* console, int16_t* samples, size_t framesCount)
+{
+    const uint32_t maxFrames = static_cast<uint32_t>(std::min<size_t>(framesCount, UINT32_MAX));
+
+    return console->console.getAudioOutput().pop(samples, maxFrames);
+}
+
+// =================================================================================================
+
+uint32_t colorboy_audio_sample_rate(const colorboy_console* /*console*/)
+{
+    return Apu::eSampleRate;
+}
+
+// =================================================================================================
+
+size_t colorboy_state_size(const colorboy_console* console)
+{
+    return console->console.getStateSize();
+}
+
+// =================================================================================================
+
+size_t colorboy_save_state(const colorboy_console* console, void* buffer, size_t capacity)
+{
+    return console->console.saveState(static_cast<uint8_t*>(buffer), capacity);
+}
+
+// =================================================================================================
+
+int colorboy_load_state(colorboy_console* console, const void* buffer, size_t size)
+{
+    return (console->console.loadState(static_cast<const uint8_t*>(buffer), size) == true) ? 1 : 0;
+}
+
+// =================================================================================================
+
+void colorboy_reset(colorboy_console* console)
+{
+    console->console.reset();
+}
@@ -0,0 +1,142 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      colorboy.h
+///
+/// \brief     C interface of the emulator, to embed consoles in any language.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef COLORBOY_H_
+#define COLORBOY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#ifdef COLORBOY_CORE_BUILD
+#define COLORBOY_API __declspec(dllexport)
+#else
+#define COLORBOY_API __declspec(dllimport)
+#endif
+#else
+#define COLORBOY_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Version of this interface, increased on every incompatible change.
+#define COLORBOY_ABI_VERSION 1
+
+/// Emulated Game Boy types.
+#define COLORBOY_MODEL_DMG 0
+#define COLORBOY_MODEL_CGB 3
+
+/// Joypad buttons, combined into the mask given to colorboy_set_input().
+#define COLORBOY_BUTTON_RIGHT 0x01
+#define COLORBOY_BUTTON_LEFT 0x02
+#define COLORBOY_BUTTON_UP 0x04
+#define COLORBOY_BUTTON_DOWN 0x08
+#define COLORBOY_BUTTON_A 0x10
+#define COLORBOY_BUTTON_B 0x20
+#define COLORBOY_BUTTON_SELECT 0x40
+#define COLORBOY_BUTTON_START 0x80
+
+/// Size of the frames, each pixel is 4 bytes in R, G, B, A order.
+#define COLORBOY_FRAME_WIDTH 160
+#define COLORBOY_FRAME_HEIGHT 144
+
+/// An emulated console. Each console is independent, different consoles may run on different
+/// threads; a console must not be used by two threads at once.
+typedef struct colorboy_console colorboy_console;
+
+/// \brief Get the version of the interface implemented by the library.
+COLORBOY_API uint32_t colorboy_abi_version(void);
+
+/// \brief Create a powered on console running a ROM file.
+///
+/// \return the console, NULL if the model is unknown or the file is not a ROM.
+COLORBOY_API colorboy_console* colorboy_create_from_file(uint32_t model, const char* romPath);
+
+/// \brief Create a powered on console running a ROM held in memory, the ROM is copied.
+///
+/// \return the console, NULL if the model is unknown or the buffer is not a ROM.
+COLORBOY_API colorboy_console* colorboy_create_from_memory(uint32_t model,
+                                                           const uint8_t* rom,
+                                                           size_t romSize);
+
+/// \brief Destroy a console, NULL is ignored.
+COLORBOY_API void colorboy_destroy(colorboy_console* console);
+
+/// \brief Run the console until the end of the next frame.
+///
+/// \return 1 if the console is running, 0 otherwise.
+COLORBOY_API int colorboy_run_frame(colorboy_console* console);
+
+/// \brief Run the console for a number of CPU cycles, 4 clocks of 4.194304 MHz each.
+///
+/// \return 1 if the console is running, 0 otherwise.
+COLORBOY_API int colorboy_run_cycles(colorboy_console* console, uint64_t cycles);
+
+/// \brief Set the mask of the pressed COLORBOY_BUTTON_* buttons.
+COLORBOY_API void colorboy_set_input(colorboy_console* console, uint8_t buttons);
+
+/// \brief Get the last completed frame, valid until the console runs again.
+COLORBOY_API const uint32_t* colorboy_framebuffer(const colorboy_console* console);
+
+/// \brief Read the interleaved left/right 16 bits samples produced since the last call.
+///
+/// \param samples receives the samples, 2 per frame.
+/// \param framesCount capacity of samples, in stereo frames.
+///
+/// \return the number of stereo frames read.
+COLORBOY_API size_t colorboy_audio_samples(colorboy_console* console,
+                                           int16_t* samples,
+                                           size_t framesCount);
+
+/// \brief Get the sample rate of the audio in Hz.
+COLORBOY_API uint32_t colorboy_audio_sample_rate(const colorboy_console* console);
+
+/// \brief Get the size of the console's state in bytes.
+COLORBOY_API size_t colorboy_state_size(const colorboy_console* console);
+
+/// \brief Save the console's state.
+///
+/// \return the size of the state, 0 if the buffer is too small.
+COLORBOY_API size_t colorboy_save_state(const colorboy_console* console,
+                                        void* buffer,
+                                        size_t capacity);
+
+/// \brief Restore a state saved by a console of the same model running the same ROM.
+///
+/// \return 1 if the state was restored, 0 if it was rejected and the console is untouched.
+COLORBOY_API int colorboy_load_state(colorboy_console* console, const void* buffer, size_t size);
+
+/// \brief Bring the console back to its power on state.
+COLORBOY_API void colorboy_reset(colorboy_console* console);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COLORBOY_H_ */
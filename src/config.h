@@ -52,11 +52,18 @@ enum class GBType : uint8_t
 };
 
 /// \brief Emulator's configuration.
+///
+/// The static members are common to every Game Boy type, the others belong to each console.
 struct GBConfig
 {
+    /// \brief Constructor.
+    ///
+    /// \param type Game Boy's type.
+    explicit GBConfig(const GBType type);
+
     static const uint32_t memorySize = cbutil::toByteValue(
         units::data::kibibyte_t(64));  ///< Gameboy CPU has 16-bit address bus (2^16).
-    static uint32_t clockFrequency;    ///< CPU clock frequency in Hz.
+    uint32_t clockFrequency;           ///< CPU clock frequency in Hz.
 
     ///< Size of the fixed parts of the Game Boy's memory.
     static const uint16_t fixedMemSize = MemoryAreasSizes::eMEMSIZE_echo +
@@ -67,8 +74,8 @@ struct GBConfig
                                          MemoryAreasSizes::eMEMSIZE_iereg;
 
     static const Coordinate lcdResolution;  ///< The Game Boy LCD is 160x144 pixels.
-    static uint16_t vRAMSize;               ///< Video ram size in Byte.
-    static uint16_t wRAMSize;               ///< Working ram size in Byte.
+    uint16_t vRAMSize;                      ///< Video ram size in Byte.
+    uint16_t wRAMSize;                      ///< Working ram size in Byte.
 };
 
 #endif /* CONFIG_H_ */
@@ -27,68 +27,1088 @@
 #include "console.h"
 
 #include "config.h"
+#include "hash.h"
 
+#include <chrono>
 #include <cstdio>
 #include <memory>
 #include <algorithm>
 #include <numeric>
 
-uint32_t GBConfig::clockFrequency;
+#include <time.h>
+
+namespace
+{
+/// \brief Offset of the boot ROM register (0xFF50) in the fixed part of the memory.
+const uint16_t bootROMRegisterOffset =
+    HardwareIORegisters::eIOREG_romswitch - MemoryAreas::eMEMADDR_echoramstart;
+
+/// \brief Get the CPU time consumed by the calling thread, in nanoseconds.
+uint64_t getThreadCPUTimeNs()
+{
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+    {
+        return 0;
+    }
+
+    return (static_cast<uint64_t>(time.tv_sec) * 1000000000) + time.tv_nsec;
+}
+
+}  // namespace
+
 const Coordinate GBConfig::lcdResolution(160, 144);
-uint16_t GBConfig::vRAMSize;
-uint16_t GBConfig::wRAMSize;
 
-Console::Console(const GBType type, const std::filesystem::path& cartPath) :
-    m_cpu(m_mmu), m_ppu(m_mmu), m_gameCart(cartPath), m_poweredOn(false)
+GBConfig::GBConfig(const GBType type)
 {
-    // Create the console's configuration.
     namespace freq = units::frequency;
     switch (type)
     {
     case GBType::eGBTYPE_dmg:
     case GBType::eGBTYPE_sgb:
     case GBType::eGBTYPE_mgb:
-        GBConfig::clockFrequency = cbutil::toHzValue(freq::megahertz_t(4.194304));
-        GBConfig::vRAMSize = MemoryAreasSizes::eMEMSIZE_vram;
-        GBConfig::wRAMSize = MemoryAreasSizes::eMEMSIZE_wram;
+        clockFrequency = cbutil::toHzValue(freq::megahertz_t(4.194304));
+        vRAMSize = MemoryAreasSizes::eMEMSIZE_vram;
+        wRAMSize = MemoryAreasSizes::eMEMSIZE_wram * 2;
         break;
 
     case GBType::eGBTYPE_cgb:
-        GBConfig::clockFrequency = cbutil::toHzValue(freq::megahertz_t(8.4));
-        GBConfig::vRAMSize = MemoryAreasSizes::eMEMSIZE_vram * 2;
-        GBConfig::wRAMSize = MemoryAreasSizes::eMEMSIZE_wram * 8;
+        clockFrequency = cbutil::toHzValue(freq::megahertz_t(8.4));
+        vRAMSize = MemoryAreasSizes::eMEMSIZE_vram * 2;
+        wRAMSize = MemoryAreasSizes::eMEMSIZE_wram * 8;
         break;
     }
+}
+
+// =================================================================================================
+
+Console::Console(const GBType type, const std::filesystem::path& cartPath) :
+    Console(type, Cartridge(cartPath))
+{
+}
+
+// =================================================================================================
+
+Console::Console(const GBType type, std::vector<uint8_t> rom) :
+    Console(type, Cartridge(std::move(rom)))
+{
+}
+
+// =================================================================================================
+
+Console::Console(const GBType type, Cartridge&& cart) :
+    m_type(type), m_config(type), m_cpu(m_mmu), m_ppu(m_mmu), m_apu(m_mmu, m_scheduler),
+    m_timer(m_mmu, m_scheduler), m_joypad(m_mmu), m_serial(m_mmu, m_scheduler),
+    m_gameCart(std::move(cart)), m_poweredOn(false),
+    m_frameDelta(Ppu::eFrameWidth, Ppu::eFrameHeight),
+    m_scaler(Ppu::eFrameWidth, Ppu::eFrameHeight),
+    m_frameRecorder(Ppu::eFrameWidth, Ppu::eFrameHeight), m_frameDeltaEnabled(false),
+    m_runAheadFrames(0), m_movieMode(MovieMode::eMOVIEMODE_none), m_movieInput(0),
+    m_movieInputDeadline(Scheduler::eNever), m_movieFrame(0), m_movieMismatchesCount(0),
+    m_profileSampleClocks(0), m_profileSampleDeadline(Scheduler::eNever),
+    m_bankSwitchesCount(0), m_vramBank(0), m_wramBank(1), m_bootROMMapped(true),
+    m_writtenPagesTracked(false)
+{
+    // The power on content of the memory is part of the movies' start state.
+    m_fixedMemory.fill(0);
+
+    m_VRAMBanks.resize(m_config.vRAMSize);
+    m_WRAMBanks.resize(m_config.wRAMSize);
+
+    m_ppu.setVRAM(m_VRAMBanks.data());
 
-    m_VRAMBanks.resize(GBConfig::vRAMSize);
-    m_WRAMBanks.resize(GBConfig::wRAMSize);
+    // The boot ROM unmaps itself by writing 1 to 0xFF50, only a power on maps it back.
+    m_mmu.setIOHandlers(HardwareIORegisters::eIOREG_romswitch,
+                        Mmu::IOReadHandler(),
+                        [this](const uint8_t byte) {
+                            if ((byte & 0x01) != 0)
+                            {
+                                mapBootROM(false);
+                            }
+                        });
+
+    if (m_type == GBType::eGBTYPE_cgb)
+    {
+        connectCGBRegisters();
+        m_ppu.setCGBPalettes(&m_cgbPalettes);
+    }
 }
 
 // =================================================================================================
 
-void Console::powerOn()
+void Console::powerOn(const BootMode mode)
 {
     // Map the fixed part of the memory into the Game Boy's internal memory.
     m_mmu.mapDataBufferToMemory(m_fixedMemory, MemoryAreas::eMEMADDR_echoramstart);
     // Map VRAM Bank 0 into the Game Boy's internal memory.
-    m_mmu.mapDataBufferToMemory(m_VRAMBanks, MemoryAreas::eMEMADDR_vrambank0start);
-    // Map WRAM Bank 0 into the Game Boy's internal memory.
-    m_mmu.mapDataBufferToMemory(m_WRAMBanks, MemoryAreas::eMEMADDR_wrambank0start);
+    mapVRAMBank(0);
+    // Map WRAM Bank 0 and 1 into the Game Boy's internal memory.
+    m_mmu.mapDataBufferToMemory(m_WRAMBanks.begin(),
+                                m_WRAMBanks.begin() + MemoryAreasSizes::eMEMSIZE_wram,
+                                MemoryAreas::eMEMADDR_wrambank0start);
+    mapWRAMBank(1);
+
+    // The ROM is shared by the console's clones. On hardware, its writes are MBC commands.
+    m_mmu.setReadOnlyEnd(MemoryAreas::eMEMADDR_vrambank0start);
 
-    // Writing 0 to 0xFF50 maps the CPU's internal ROM to the address 0x0000.
-    m_mmu.writeByte(0x0, HardwareIORegisters::eIOREG_romswitch);
+    // The CPU's internal ROM is mapped to the address 0x0000 until the boot ROM unmaps it. Without
+    // an MBC, the banks 0 and 1 stay mapped.
+    mapCartridgeROM(MemoryAreas::eMEMADDR_cartridgeheaderstart,
+                    MemoryAreas::eMEMADDR_vrambank0start);
 
-    auto cartROMBank0 = m_gameCart.getROMBank(0);
-    m_mmu.mapDataBufferToMemory(cartROMBank0.first + MemoryAreas::eMEMADDR_cartridgeheaderstart,
-                                cartROMBank0.second,
-                                MemoryAreas::eMEMADDR_cartridgeheaderstart);
+    if (mode == BootMode::eBOOTMODE_fastStart)
+    {
+        skipBootROM();
+    }
 
     m_poweredOn = true;
 
-    while ((m_poweredOn == true) && (m_cpu.cycle() == true))
+    m_powerOnState.resize(getStateSize());
+    saveState(m_powerOnState.data(), m_powerOnState.size());
+}
+
+// =================================================================================================
+
+void Console::reset()
+{
+    if (m_poweredOn == false)
+    {
+        powerOn();
+        return;
+    }
+
+    loadState(m_powerOnState.data(), m_powerOnState.size());
+}
+
+// =================================================================================================
+
+bool Console::runFrame()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t startCPUNs = getThreadCPUTimeNs();
+
+    const bool running = runDisplayedFrame();
+
+    const uint64_t hostNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+    publishMetrics(hostNs, getThreadCPUTimeNs() - startCPUNs);
+
+    return running;
+}
+
+// =================================================================================================
+
+void Console::publishMetrics(const uint64_t hostNs, const uint64_t hostCPUNs)
+{
+    // Single writer: plain relaxed stores, the readers never slow the emulation down.
+    const auto add = [](std::atomic<uint64_t>& metric, const uint64_t value) {
+        metric.store(metric.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    };
+
+    // Like the CPU's counters, the clocks include the run-ahead frames and never go back with a
+    // state load: the ratios between them hold.
+    m_metrics.emulatedClocks.store(m_cpu.getCyclesCount() * 4, std::memory_order_relaxed);
+    add(m_metrics.frames, 1);
+    m_metrics.instructions.store(m_cpu.getInstructionsCount(), std::memory_order_relaxed);
+    m_metrics.interrupts.store(m_cpu.getInterruptsCount(), std::memory_order_relaxed);
+    m_metrics.bankSwitches.store(m_bankSwitchesCount, std::memory_order_relaxed);
+    m_metrics.haltedClocks.store(m_cpu.getStoppedCyclesCount() * 4, std::memory_order_relaxed);
+    add(m_metrics.hostNs, hostNs);
+    add(m_metrics.hostCPUNs, hostCPUNs);
+    m_metrics.frameTimeNs.record(hostNs);
+}
+
+// =================================================================================================
+
+bool Console::runDisplayedFrame()
+{
+    if (m_runAheadFrames == 0)
+    {
+        const bool running = emulateFrame();
+        checkMovieFrame();
+
+        return running;
+    }
+
+    // The frame of the timeline is heard but not seen.
+    presentFrames(false);
+    bool running = emulateFrame();
+    checkMovieFrame();
+    const size_t movieInput = m_movieInput;
+    const uint64_t movieInputDeadline = m_movieInputDeadline;
+
+    // The frames ahead are not heard, only the last one is seen. Nor are they profiled or traced.
+    m_apu.setSynthesisPaused(true);
+    const uint64_t profileSampleDeadline = m_profileSampleDeadline;
+    m_profileSampleDeadline = Scheduler::eNever;
+    m_cpu.setCallTracer(nullptr);
+    m_cpu.setInstructionTracer(nullptr);
+    const size_t stateSize = saveState(m_runAheadState.data(), m_runAheadState.size());
+    CBASSERT(stateSize != 0, "Run-ahead state buffer too small");
+
+    for (uint32_t frame = 1; (frame <= m_runAheadFrames) && (running == true); ++frame)
+    {
+        if (frame == m_runAheadFrames)
+        {
+            presentFrames(true);
+        }
+        running = emulateFrame();
+    }
+    presentFrames(true);
+
+    // Back to the timeline.
+    loadState(m_runAheadState.data(), stateSize);
+    m_apu.setSynthesisPaused(false);
+    m_movieInput = movieInput;
+    m_movieInputDeadline = movieInputDeadline;
+    m_profileSampleDeadline = profileSampleDeadline;
+    m_cpu.setCallTracer((profileSampleDeadline != Scheduler::eNever) ? m_profiler.get() : nullptr);
+    m_cpu.setInstructionTracer(m_traceWriter.get());
+
+    return running;
+}
+
+// =================================================================================================
+
+void Console::startProfiling(const uint32_t sampleClocks)
+{
+    CBASSERT(sampleClocks > 0, "Profiling without samples");
+
+    if (m_profiler == nullptr)
+    {
+        m_profiler = std::make_unique<GuestProfiler>(
+            [this](const uint16_t address) { return getCodeBank(address); });
+    }
+    m_profiler->reset();
+
+    m_profileSampleClocks = sampleClocks;
+    m_profileSampleDeadline = m_scheduler.getNow() + sampleClocks;
+    m_cpu.setCallTracer(m_profiler.get());
+}
+
+// =================================================================================================
+
+void Console::stopProfiling()
+{
+    m_profileSampleDeadline = Scheduler::eNever;
+    m_cpu.setCallTracer(nullptr);
+}
+
+// =================================================================================================
+
+bool Console::startTrace(const std::filesystem::path& path)
+{
+    stopTrace();
+
+    m_traceWriter = std::make_unique<TraceWriter>();
+    if (m_traceWriter->open(path) == false)
+    {
+        m_traceWriter.reset();
+
+        return false;
+    }
+    m_cpu.setInstructionTracer(m_traceWriter.get());
+
+    return true;
+}
+
+// =================================================================================================
+
+bool Console::stopTrace()
+{
+    m_cpu.setInstructionTracer(nullptr);
+    const bool written = (m_traceWriter == nullptr) || (m_traceWriter->close() == true);
+    m_traceWriter.reset();
+
+    return written;
+}
+
+// =================================================================================================
+
+void Console::sampleProfile()
+{
+    m_profiler->sample(m_cpu.getCurrentInstructionAddress());
+
+    // From the current clock: a loaded state may have moved the clock far from the deadline.
+    m_profileSampleDeadline = m_scheduler.getNow() + m_profileSampleClocks;
+}
+
+// =================================================================================================
+
+uint16_t Console::getCodeBank(const uint16_t address) const
+{
+    if (address >= MemoryAreas::eMEMADDR_vrambank0start)
+    {
+        return GuestProfiler::eNoBank;
+    }
+
+    // Writing 1 to 0xFF50 unmaps the boot ROM.
+    if ((address < MemoryAreas::eMEMADDR_cartridgeheaderstart) &&
+        (m_mmu.readByte(HardwareIORegisters::eIOREG_romswitch) == 0))
+    {
+        return GuestProfiler::eBootROMBank;
+    }
+
+    // The cartridges are mapped without any bank controller: bank 1 stays at 0x4000.
+    return (address < MemoryAreas::eMEMADDR_rombank1start) ? 0 : 1;
+}
+
+// =================================================================================================
+
+void Console::setRunAhead(const uint32_t frames)
+{
+    m_runAheadFrames = frames;
+    m_runAheadState.resize((frames > 0) ? getStateSize() : 0);
+}
+
+// =================================================================================================
+
+inline bool Console::stepCycle()
+{
+    // The inputs are played where the frontend gave them: between two CPU cycles.
+    if (m_scheduler.getNow() >= m_movieInputDeadline)
+    {
+        applyMovieInputs();
+    }
+
+    if ((m_poweredOn == false) || (m_cpu.cycle() == false))
+    {
+        return false;
+    }
+
+    // Each CPU cycle lasts 4 clocks.
+    m_scheduler.advance(4);
+    m_ppu.cycle(m_cpu.getCurrentCPUCycle());
+
+    if (m_scheduler.getNow() >= m_profileSampleDeadline)
+    {
+        sampleProfile();
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+bool Console::emulateFrame()
+{
+    const uint64_t framesCount = m_ppu.getFramesCount();
+    while (m_ppu.getFramesCount() == framesCount)
+    {
+        if (stepCycle() == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+bool Console::runCycles(const uint64_t cycles)
+{
+    for (uint64_t cycle = 0; cycle < cycles; ++cycle)
+    {
+        if (stepCycle() == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+void Console::setJoypadButtons(const uint8_t buttons)
+{
+    if (m_movieMode == MovieMode::eMOVIEMODE_playing)
+    {
+        return;
+    }
+
+    if ((m_movieMode == MovieMode::eMOVIEMODE_recording) && (buttons != m_joypad.getButtons()))
+    {
+        m_movie.addInput(m_scheduler.getNow(), buttons);
+    }
+    m_joypad.setButtons(buttons);
+}
+
+// =================================================================================================
+
+bool Console::startMovieRecording()
+{
+    if (m_poweredOn == false)
+    {
+        return false;
+    }
+
+    m_movieState.resize(getStateSize());
+    saveState(m_movieState.data(), m_movieState.size());
+
+    const std::vector<uint8_t>& rom = m_gameCart.getROM();
+    m_movie.start(m_type,
+                  cbutil::hashXXH64(rom.data(), rom.size()),
+                  m_movieState.data(),
+                  m_movieState.size());
+    m_movieMode = MovieMode::eMOVIEMODE_recording;
+
+    return true;
+}
+
+// =================================================================================================
+
+bool Console::stopMovieRecording(const std::filesystem::path& path)
+{
+    if (m_movieMode != MovieMode::eMOVIEMODE_recording)
+    {
+        return false;
+    }
+
+    m_movieMode = MovieMode::eMOVIEMODE_none;
+
+    return m_movie.save(path);
+}
+
+// =================================================================================================
+
+bool Console::playMovie(const std::filesystem::path& path)
+{
+    m_movieMode = MovieMode::eMOVIEMODE_none;
+    m_movieInputDeadline = Scheduler::eNever;
+
+    const std::vector<uint8_t>& rom = m_gameCart.getROM();
+    if ((m_movie.load(path) == false) || (m_movie.getType() != m_type) ||
+        (m_movie.getROMHash() != cbutil::hashXXH64(rom.data(), rom.size())) ||
+        (m_movie.getFrames().empty() == true))
+    {
+        return false;
+    }
+
+    const std::vector<uint8_t>& startState = m_movie.getStartState();
+    if (loadState(startState.data(), startState.size()) == false)
+    {
+        return false;
+    }
+
+    m_poweredOn = true;
+    m_movieState.resize(startState.size());
+    m_movieInput = 0;
+    m_movieFrame = 0;
+    m_movieMismatchesCount = 0;
+    m_movieMode = MovieMode::eMOVIEMODE_playing;
+    applyMovieInputs();
+
+    return true;
+}
+
+// =================================================================================================
+
+void Console::applyMovieInputs()
+{
+    const std::vector<Movie::InputEvent>& inputs = m_movie.getInputs();
+    const uint64_t now = m_scheduler.getNow();
+    while ((m_movieInput < inputs.size()) && (inputs[m_movieInput].clock <= now))
+    {
+        m_joypad.setButtons(inputs[m_movieInput].buttons);
+        ++m_movieInput;
+    }
+
+    m_movieInputDeadline =
+        (m_movieInput < inputs.size()) ? inputs[m_movieInput].clock : Scheduler::eNever;
+}
+
+// =================================================================================================
+
+void Console::checkMovieFrame()
+{
+    switch (m_movieMode)
+    {
+    case MovieMode::eMOVIEMODE_none:
+        break;
+
+    case MovieMode::eMOVIEMODE_recording:
+        m_movie.addFrame(hashState());
+        break;
+
+    case MovieMode::eMOVIEMODE_playing:
+        if (hashState() != m_movie.getFrames()[m_movieFrame])
+        {
+            ++m_movieMismatchesCount;
+        }
+
+        if (++m_movieFrame == m_movie.getFrames().size())
+        {
+            m_movieMode = MovieMode::eMOVIEMODE_none;
+            m_movieInputDeadline = Scheduler::eNever;
+        }
+        break;
+    }
+}
+
+// =================================================================================================
+
+uint64_t Console::hashState()
+{
+    const size_t stateSize = saveState(m_movieState.data(), m_movieState.size());
+    StateReader reader(m_movieState.data(), stateSize);
+
+    static constexpr uint32_t hashedSections[] = {savestate::eSECTION_console,
+                                                  savestate::eSECTION_memory,
+                                                  savestate::eSECTION_scheduler,
+                                                  savestate::eSECTION_cpu,
+                                                  savestate::eSECTION_ppu,
+                                                  savestate::eSECTION_timer,
+                                                  savestate::eSECTION_joypad,
+                                                  savestate::eSECTION_serial,
+                                                  savestate::eSECTION_palettes};
+
+    uint64_t hash = 0;
+    for (const uint32_t tag : hashedSections)
+    {
+        size_t size;
+        const uint8_t* data = reader.getSectionData(tag, size);
+        if (data != nullptr)
+        {
+            hash = cbutil::hashXXH64(data, size, hash);
+        }
+    }
+
+    return hash;
+}
+
+// =================================================================================================
+
+void Console::presentFrames(const bool present)
+{
+    if (present == true)
+    {
+        connectFrameSinks();
+        m_ppu.setFrameDelta((m_frameDeltaEnabled == true) ? &m_frameDelta : nullptr);
+    }
+    else
+    {
+        m_ppu.setFrameSink(nullptr);
+        m_ppu.setFrameDelta(nullptr);
+    }
+}
+
+// =================================================================================================
+
+bool Console::exportFrames(const std::string& segmentName, const ScaleFilter filter)
+{
+    m_ppu.setFrameSink(nullptr);
+
+    const uint8_t factor = Scaler::getScaleFactor(filter);
+    if (m_frameExporter.open(
+            segmentName, Ppu::eFrameWidth * factor, Ppu::eFrameHeight * factor, factor) == false)
+    {
+        connectFrameSinks();
+        return false;
+    }
+
+    if (filter != ScaleFilter::eSCALEFILTER_none)
     {
-        m_ppu.cycle(m_cpu.getCurrentCPUCycle());
+        if (m_scalerThreadPool == nullptr)
+        {
+            // The calling thread takes part in the scaling too.
+            const uint32_t threadsCount = std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+            m_scalerThreadPool = std::make_unique<ThreadPool>(threadsCount - 1);
+        }
+
+        m_scaler.setThreadPool(m_scalerThreadPool.get());
+        m_scaler.setOutput(&m_frameExporter);
     }
+    m_scaler.setFilter(filter);
+
+    connectFrameSinks();
+
+    return true;
+}
+
+// =================================================================================================
+
+bool Console::recordFrames(const std::filesystem::path& path, const RecordFormat format)
+{
+    const bool recording = m_frameRecorder.open(path, format);
+
+    connectFrameSinks();
+
+    return recording;
+}
+
+// =================================================================================================
+
+void Console::stopRecording()
+{
+    m_frameRecorder.close();
+}
+
+// =================================================================================================
+
+void Console::connectFrameSinks()
+{
+    FrameSink* frameSink = nullptr;
+    if (m_frameExporter.isOpen() == true)
+    {
+        frameSink = (m_scaler.getFilter() == ScaleFilter::eSCALEFILTER_none) ?
+                        static_cast<FrameSink*>(&m_frameExporter) :
+                        static_cast<FrameSink*>(&m_scaler);
+    }
+
+    // The native frames are recorded, before any scaling.
+    if (m_frameRecorder.isOpen() == true)
+    {
+        m_frameRecorder.setOutput(frameSink);
+        frameSink = &m_frameRecorder;
+    }
+
+    m_ppu.setFrameSink(frameSink);
+}
+
+// =================================================================================================
+
+void Console::enableFrameDelta(const bool enable)
+{
+    m_frameDeltaEnabled = enable;
+    m_frameDelta.reset();
+    m_ppu.setFrameDelta((enable == true) ? &m_frameDelta : nullptr);
+    m_frameExporter.setFrameDelta((enable == true) ? &m_frameDelta : nullptr);
+}
+
+// =================================================================================================
+
+size_t Console::getStateSize() const
+{
+    StateWriter writer(nullptr, 0);
+    writeState(writer);
+
+    return writer.finish();
+}
+
+// =================================================================================================
+
+size_t Console::saveState(uint8_t* buffer, const size_t capacity) const
+{
+    StateWriter writer(buffer, capacity);
+    writeState(writer);
+
+    const size_t size = writer.finish();
+
+    return (writer.hasOverflowed() == true) ? 0 : size;
+}
+
+// =================================================================================================
+
+bool Console::loadState(const uint8_t* buffer, const size_t size)
+{
+    return restoreState(buffer, size, false);
+}
+
+// =================================================================================================
+
+bool Console::reloadState(const uint8_t* buffer, const size_t size)
+{
+    return restoreState(buffer, size, m_writtenPagesTracked);
+}
+
+// =================================================================================================
+
+bool Console::restoreState(const uint8_t* buffer, const size_t size, const bool writtenPagesOnly)
+{
+    StateReader reader(buffer, size);
+    if (reader.isValid() == false)
+    {
+        return false;
+    }
+
+    // The state must have the exact layout of this console's own state.
+    StateWriter layout(nullptr, 0);
+    writeState(layout);
+    for (uint16_t sectionIdx = 0; sectionIdx < layout.getSectionsCount(); ++sectionIdx)
+    {
+        if (reader.hasSection(layout.getSections()[sectionIdx]) == false)
+        {
+            return false;
+        }
+    }
+
+    GBType type = GBType::eGBTYPE_dmg;
+    uint8_t vramBank = 0;
+    uint8_t wramBank = 0;
+    if ((reader.openSection(savestate::eSECTION_console) == false) ||
+        (reader.read(type) == false) || (reader.read(vramBank) == false) ||
+        (reader.read(wramBank) == false) || (type != m_type))
+    {
+        return false;
+    }
+
+    // The banks are mapped as pointers into the memory, they must exist in this console.
+    const size_t vramBanksCount = m_VRAMBanks.size() / MemoryAreasSizes::eMEMSIZE_vram;
+    const size_t wramBanksCount = m_WRAMBanks.size() / MemoryAreasSizes::eMEMSIZE_wram;
+    if ((vramBank >= vramBanksCount) || (wramBank == 0) || (wramBank >= wramBanksCount))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t>& cartRAM = m_gameCart.getRAM();
+    if (writtenPagesOnly == true)
+    {
+        size_t memorySize = 0;
+        const uint8_t* fixedMemory = reader.getSectionData(savestate::eSECTION_memory, memorySize);
+        const uint8_t* vram = fixedMemory + m_fixedMemory.size();
+        const uint8_t* wram = vram + m_VRAMBanks.size();
+
+        std::copy_n(fixedMemory, m_fixedMemory.size(), m_fixedMemory.begin());
+        restoreWrittenPages(vram, wram);
+        std::copy_n(wram + m_WRAMBanks.size(), cartRAM.size(), cartRAM.begin());
+    }
+    else
+    {
+        reader.openSection(savestate::eSECTION_memory);
+        reader.readBytes(m_fixedMemory.data(), m_fixedMemory.size());
+        reader.readBytes(m_VRAMBanks.data(), m_VRAMBanks.size());
+        reader.readBytes(m_WRAMBanks.data(), m_WRAMBanks.size());
+        reader.readBytes(cartRAM.data(), cartRAM.size());
+    }
+
+    // The memory now matches the state, the next reload starts from here.
+    m_writtenPages.clear();
+
+    // Remapping a bank rewrites thousands of pointers, skip it when the bank is already mapped.
+    if (vramBank != m_vramBank)
+    {
+        mapVRAMBank(vramBank);
+    }
+    if (wramBank != m_wramBank)
+    {
+        mapWRAMBank(wramBank);
+    }
+    const bool bootROMMapped = (m_fixedMemory[bootROMRegisterOffset] == 0);
+    if (bootROMMapped != m_bootROMMapped)
+    {
+        mapBootROM(bootROMMapped);
+    }
+
+    // The sizes were checked above, the components cannot fail.
+    m_scheduler.loadState(reader);
+    m_cpu.loadState(reader);
+    m_ppu.loadState(reader);
+    m_timer.loadState(reader);
+    m_joypad.loadState(reader);
+    m_serial.loadState(reader);
+    m_apu.loadState(reader);
+    m_cgbPalettes.loadState(reader);
+
+    return true;
+}
+
+// =================================================================================================
+
+void Console::restoreWrittenPages(const uint8_t* vram, const uint8_t* wram)
+{
+    const size_t vramBanksCount = m_VRAMBanks.size() / MemoryAreasSizes::eMEMSIZE_vram;
+    const size_t wramBanksCount = m_WRAMBanks.size() / MemoryAreasSizes::eMEMSIZE_wram;
+
+    // A page only tells the address written, not the bank that was mapped at that time: the
+    // page is copied back in every bank that can be mapped there.
+    const auto copyPage = [](const uint8_t* source,
+                             std::vector<uint8_t>& banks,
+                             const size_t offset,
+                             const size_t firstBank,
+                             const size_t lastBank,
+                             const size_t bankSize) {
+        for (size_t bank = firstBank; bank < lastBank; ++bank)
+        {
+            const size_t pageOffset = (bank * bankSize) + offset;
+            std::copy_n(source + pageOffset, 0x100, banks.begin() + pageOffset);
+        }
+    };
+
+    for (size_t idx = 0; idx < m_writtenPages.size(); ++idx)
+    {
+        const uint16_t address = m_writtenPages[idx] << 8;
+        if ((address >= MemoryAreas::eMEMADDR_vrambank0start) &&
+            (address < MemoryAreas::eMEMADDR_vrambank0start + MemoryAreasSizes::eMEMSIZE_vram))
+        {
+            copyPage(vram,
+                     m_VRAMBanks,
+                     address - MemoryAreas::eMEMADDR_vrambank0start,
+                     0,
+                     vramBanksCount,
+                     MemoryAreasSizes::eMEMSIZE_vram);
+        }
+        else if ((address >= MemoryAreas::eMEMADDR_wrambank0start) &&
+                 (address < MemoryAreas::eMEMADDR_wrambank0start + MemoryAreasSizes::eMEMSIZE_wram))
+        {
+            copyPage(wram,
+                     m_WRAMBanks,
+                     address - MemoryAreas::eMEMADDR_wrambank0start,
+                     0,
+                     1,
+                     MemoryAreasSizes::eMEMSIZE_wram);
+        }
+        else if ((address >= MemoryAreas::eMEMADDR_wrambank0start +
+                                 MemoryAreasSizes::eMEMSIZE_wram) &&
+                 (address < MemoryAreas::eMEMADDR_wrambank0start +
+                                (MemoryAreasSizes::eMEMSIZE_wram * 2)))
+        {
+            copyPage(wram,
+                     m_WRAMBanks,
+                     address - MemoryAreas::eMEMADDR_wrambank0start -
+                         MemoryAreasSizes::eMEMSIZE_wram,
+                     1,
+                     wramBanksCount,
+                     MemoryAreasSizes::eMEMSIZE_wram);
+        }
+    }
+}
+
+// =================================================================================================
+
+std::unique_ptr<Console> Console::clone() const
+{
+    // The copied cartridge shares the ROM, the private constructor rules out std::make_unique.
+    std::unique_ptr<Console> copy(new Console(m_type, Cartridge(m_gameCart)));
+    if (m_poweredOn == true)
+    {
+        copy->powerOn();
+        copy->m_powerOnState = m_powerOnState;
+
+        std::vector<uint8_t> state(getStateSize());
+        saveState(state.data(), state.size());
+        copy->loadState(state.data(), state.size());
+    }
+
+    return copy;
+}
+
+// =================================================================================================
+
+void Console::trackWrittenPages(const bool enable)
+{
+    m_writtenPagesTracked = enable;
+    m_writtenPages.clear();
+    m_mmu.setWrittenPages((enable == true) ? &m_writtenPages : nullptr);
+}
+
+// =================================================================================================
+
+void Console::writeState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_console, eStateVersion);
+    writer.write(m_type);
+    writer.write(m_vramBank);
+    writer.write(m_wramBank);
+    writer.endSection();
+
+    const std::vector<uint8_t>& cartRAM = m_gameCart.getRAM();
+    writer.beginSection(savestate::eSECTION_memory, eStateVersion);
+    writer.writeBytes(m_fixedMemory.data(), m_fixedMemory.size());
+    writer.writeBytes(m_VRAMBanks.data(), m_VRAMBanks.size());
+    writer.writeBytes(m_WRAMBanks.data(), m_WRAMBanks.size());
+    writer.writeBytes(cartRAM.data(), cartRAM.size());
+    writer.endSection();
+
+    m_scheduler.saveState(writer);
+    m_cpu.saveState(writer);
+    m_ppu.saveState(writer);
+    m_timer.saveState(writer);
+    m_joypad.saveState(writer);
+    m_serial.saveState(writer);
+    m_apu.saveState(writer);
+    m_cgbPalettes.saveState(writer);
+}
+
+// =================================================================================================
+
+void Console::connectCGBRegisters()
+{
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_vbk,
+        [this]() -> uint8_t { return 0xFE | m_vramBank; },
+        [this](const uint8_t byte) {
+            ++m_bankSwitchesCount;
+            mapVRAMBank(byte & 0x01);
+        });
+
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_svbk,
+        [this]() -> uint8_t { return 0xF8 | m_wramBank; },
+        // Selecting bank 0 selects bank 1.
+        [this](const uint8_t byte) {
+            ++m_bankSwitchesCount;
+            mapWRAMBank(std::max(byte & 0x07, 1));
+        });
+
+    for (const bool obj : {false, true})
+    {
+        const uint16_t specReg = (obj == true) ? HardwareIORegisters::eIOREG_ocps
+                                               : HardwareIORegisters::eIOREG_bcps;
+
+        m_mmu.setIOHandlers(
+            specReg,
+            [this, obj]() -> uint8_t { return m_cgbPalettes.readSpecification(obj); },
+            [this, obj](const uint8_t byte) { m_cgbPalettes.writeSpecification(obj, byte); });
+        m_mmu.setIOHandlers(
+            specReg + 1,
+            [this, obj]() -> uint8_t { return m_cgbPalettes.readData(obj); },
+            [this, obj](const uint8_t byte) { m_cgbPalettes.writeData(obj, byte); });
+    }
+}
+
+// =================================================================================================
+
+void Console::skipBootROM()
+{
+    // The registers documented for each boot ROM, A tells the games which type they run on.
+    if (m_type == GBType::eGBTYPE_cgb)
+    {
+        m_cpu.setPostBootState(0x1180, 0x0000, 0xFF56, 0x000D);
+    }
+    else
+    {
+        m_cpu.setPostBootState(0x01B0, 0x0013, 0x00D8, 0x014D);
+    }
+
+    // The APU ignores the writes while it is off, it is powered on first. The boot sound is over:
+    // no channel is triggered again, NR52 reads 0xF0 rather than 0xF1. LY and STAT belong to the
+    // PPU, which starts from its power on state. The boot ROM never writes OBP0 and OBP1. IF holds
+    // the V-Blank request of the boot's last frame.
+    using io = HardwareIORegisters;
+    const std::pair<uint16_t, uint8_t> ioRegisters[] = {
+        {io::eIOREG_nr52, 0x80}, {io::eIOREG_nr10, 0x80}, {io::eIOREG_nr11, 0xBF},
+        {io::eIOREG_nr12, 0xF3}, {io::eIOREG_nr13, 0xFF}, {io::eIOREG_nr14, 0x3F},
+        {io::eIOREG_nr21, 0x3F}, {io::eIOREG_nr22, 0x00}, {io::eIOREG_nr23, 0xFF},
+        {io::eIOREG_nr24, 0x3F}, {io::eIOREG_nr30, 0x7F}, {io::eIOREG_nr31, 0xFF},
+        {io::eIOREG_nr32, 0x9F}, {io::eIOREG_nr33, 0xFF}, {io::eIOREG_nr34, 0x3F},
+        {io::eIOREG_nr41, 0xFF}, {io::eIOREG_nr42, 0x00}, {io::eIOREG_nr43, 0x00},
+        {io::eIOREG_nr44, 0x3F}, {io::eIOREG_nr50, 0x77}, {io::eIOREG_nr51, 0xF3},
+        {io::eIOREG_sc, 0x7E},   {io::eIOREG_lcdc, 0x91}, {io::eIOREG_bgp, 0xFC},
+        {io::eIOREG_if, 0xE1}};
+    for (const auto& [address, value] : ioRegisters)
+    {
+        m_mmu.writeByte(value, address);
+    }
+
+    // The DMG's boot ROM always lasts as long, DIV reads 0xAB when it ends. The CGB's length
+    // depends on the cartridge, its DIV starts from the power on state.
+    if (m_type == GBType::eGBTYPE_dmg)
+    {
+        m_timer.setCounter(0xABCC);
+    }
+
+    // A ROM too short to hold the logo would be read past its end, the VRAM stays blank.
+    if (m_gameCart.getROM().size() >= 0x0134)
+    {
+        drawBootLogo();
+    }
+
+    // The values last pushed by the boot ROM remain below the top of its stack.
+    m_mmu.writeByte(0x39, 0xFFFA);
+    m_mmu.writeByte(0x01, 0xFFFB);
+    m_mmu.writeByte(0x2E, 0xFFFC);
+
+    mapBootROM(false);
+}
+
+// =================================================================================================
+
+void Console::drawBootLogo()
+{
+    // The logo drawn by the boot ROM: tiles 1 to 24 hold the cartridge's logo with each pixel
+    // doubled in both directions, tile 25 holds the (R) of the boot ROM.
+    const std::vector<uint8_t>& rom = m_gameCart.getROM();
+    uint16_t address = 0x8010;
+    for (uint16_t logoIdx = 0x0104; logoIdx < 0x0134; ++logoIdx)
+    {
+        for (const uint8_t nibble : {rom[logoIdx] >> 4, rom[logoIdx] & 0x0F})
+        {
+            uint8_t doubled = 0;
+            for (int8_t bit = 3; bit >= 0; --bit)
+            {
+                doubled = (doubled << 2) | (((nibble >> bit) & 0x01) * 0x03);
+            }
+
+            m_mmu.writeByte(doubled, address);
+            m_mmu.writeByte(doubled, address + 2);
+            address += 4;
+        }
+    }
+
+    const std::array<uint8_t, 256>& bootROM = m_cpu.getBootROM();
+    for (uint16_t glyphIdx = 0; glyphIdx < 8; ++glyphIdx, address += 2)
+    {
+        m_mmu.writeByte(bootROM[0x00D8 + glyphIdx], address);
+    }
+
+    // The logo's two rows of 12 tiles and the (R) in the tile map.
+    for (uint8_t tileIdx = 0; tileIdx < 12; ++tileIdx)
+    {
+        m_mmu.writeByte(tileIdx + 0x01, 0x9904 + tileIdx);
+        m_mmu.writeByte(tileIdx + 0x0D, 0x9924 + tileIdx);
+    }
+    m_mmu.writeByte(0x19, 0x9910);
+}
+
+// =================================================================================================
+
+void Console::mapBootROM(const bool mapped)
+{
+    m_bootROMMapped = mapped;
+    m_fixedMemory[bootROMRegisterOffset] = (mapped == true) ? 0 : 1;
+
+    if (mapped == true)
+    {
+        m_cpu.mapBootROM();
+    }
+    else
+    {
+        mapCartridgeROM(MemoryAreas::eMEMADDR_rombank0start,
+                        MemoryAreas::eMEMADDR_cartridgeheaderstart);
+    }
+}
+
+// =================================================================================================
+
+void Console::mapCartridgeROM(const uint16_t startAddr, const uint16_t endAddr)
+{
+    // The addresses past the end of a short ROM read as the open bus.
+    m_mmu.unmapMemory(startAddr, endAddr);
+
+    std::vector<uint8_t>& rom = m_gameCart.getROM();
+    const size_t mappedEnd = std::min<size_t>(endAddr, rom.size());
+    if (startAddr < mappedEnd)
+    {
+        m_mmu.mapDataBufferToMemory(rom.begin() + startAddr, rom.begin() + mappedEnd, startAddr);
+    }
+}
+
+// =================================================================================================
+
+void Console::mapVRAMBank(const uint8_t bank)
+{
+    m_vramBank = bank;
+
+    const auto bankStart = m_VRAMBanks.begin() + (bank * MemoryAreasSizes::eMEMSIZE_vram);
+    m_mmu.mapDataBufferToMemory(bankStart,
+                                bankStart + MemoryAreasSizes::eMEMSIZE_vram,
+                                MemoryAreas::eMEMADDR_vrambank0start);
+}
+
+// =================================================================================================
+
+void Console::mapWRAMBank(const uint8_t bank)
+{
+    m_wramBank = bank;
+
+    const auto bankStart = m_WRAMBanks.begin() + (bank * MemoryAreasSizes::eMEMSIZE_wram);
+    m_mmu.mapDataBufferToMemory(bankStart,
+                                bankStart + MemoryAreasSizes::eMEMSIZE_wram,
+                                MemoryAreas::eMEMADDR_wrambank0start +
+                                    MemoryAreasSizes::eMEMSIZE_wram);
 }
 
 // =================================================================================================
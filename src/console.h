@@ -32,9 +32,32 @@
 #include "mmu.h"
 #include "cpu.h"
 #include "ppu.h"
+#include "apu.h"
+#include "timer.h"
+#include "joypad.h"
+#include "serial.h"
+#include "scheduler.h"
 #include "cartridge.h"
+#include "savestate.h"
+#include "movie.h"
+#include "frameexporter.h"
+#include "guestprofiler.h"
+#include "tracewriter.h"
+#include "metrics.h"
+#include "framerecorder.h"
+#include "scaler.h"
+#include "threadpool.h"
 
 #include <filesystem>
+#include <memory>
+#include <string>
+
+/// \brief How a console starts.
+enum class BootMode : uint8_t
+{
+    eBOOTMODE_bootROM,   ///< The CPU runs the boot ROM, which then hands over to the cartridge.
+    eBOOTMODE_fastStart  ///< The console starts in the state left by the boot ROM.
+};
 
 /// \brief Representation of a Game Boy console with its internal components.
 class Console
@@ -46,15 +69,391 @@ public:
     /// \param cartPath path to the game ROM file.
     Console(const GBType type, const std::filesystem::path& cartPath);
 
-    /// \brief Power on the console.
-    void powerOn();
+    /// \brief Constructor.
+    ///
+    /// \param type Game Boy's type to emulate.
+    /// \param rom content of the game ROM.
+    Console(const GBType type, std::vector<uint8_t> rom);
+
+    /// \brief Check if the cartridge holds a ROM, a missing or truncated file does not.
+    ///
+    /// Such a console still runs, the part of the ROM missing reads as the open bus.
+    bool isCartridgeValid() const { return m_gameCart.isROMValid(); }
+
+    /// \brief Power on the console: map its memory and start the boot ROM.
+    ///
+    /// \param mode eBOOTMODE_fastStart to skip the 2.5 million cycles of the boot ROM: the
+    ///             registers, the I/O registers and the logo in the VRAM get their post-boot
+    ///             values and the cartridge starts right away.
+    void powerOn(const BootMode mode = BootMode::eBOOTMODE_bootROM);
+
+    /// \brief Run the console until the PPU completes a frame.
+    ///
+    /// With run-ahead, the frame of the console's own timeline is emulated without being
+    /// displayed, then the next frames are emulated ahead and the last one is displayed before
+    /// going back to the console's timeline.
+    ///
+    /// \return true if the console is running, false if it is powered off.
+    bool runFrame();
+
+    /// \brief Get the configuration of the emulated Game Boy.
+    const GBConfig& getConfig() const { return m_config; }
+
+    /// \brief Get the master clock: the clocks elapsed since the console was created.
+    uint64_t getClock() const { return m_scheduler.getNow(); }
+
+    /// \brief Read a byte of the memory as the CPU sees it.
+    uint8_t readMemory(const uint16_t address) const { return m_mmu.readByte(address); }
+
+    /// \brief Run the console for a number of CPU cycles, 4 clocks each.
+    ///
+    /// The run-ahead only applies to runFrame(), and so do the movies' frame checks.
+    ///
+    /// \param cycles CPU cycles to run.
+    ///
+    /// \return true if the console is running, false if it is powered off.
+    bool runCycles(const uint64_t cycles);
+
+    /// \brief Bring the console back to its state right after powerOn().
+    ///
+    /// The cartridge RAM goes back to its power on content too.
+    void reset();
+
+    /// \brief Get the last completed frame: 160x144 pixels in the getFramePixelFormat() layout.
+    const uint32_t* getFrameBuffer() const { return m_ppu.getFrame(); }
+
+    /// \brief Hide the game's own input latency by displaying frames ahead of its timeline.
+    ///
+    /// Each runFrame() then emulates 1 + frames frames, plus a save and a load of the state.
+    ///
+    /// \param frames frames displayed ahead, 0 to disable the run-ahead.
+    void setRunAhead(const uint32_t frames);
+
+    /// \brief Get the frames displayed ahead of the console's timeline.
+    uint32_t getRunAhead() const { return m_runAheadFrames; }
+
+    /// \brief Press or release the joypad's buttons.
+    ///
+    /// The change is recorded into the movie being recorded, and ignored while a movie plays.
+    ///
+    /// \param buttons JoypadButtons mask of the pressed buttons.
+    void setJoypadButtons(const uint8_t buttons);
+
+    /// \brief Get the bytes sent on the serial port since the console was created or cleared.
+    const std::string& getSerialOutput() const { return m_serial.getOutput(); }
+
+    /// \brief Forget the bytes sent on the serial port.
+    void clearSerialOutput() { m_serial.clearOutput(); }
+
+    /// \brief Start recording the joypad inputs into a movie, from the current state.
+    ///
+    /// \return true if the recording started, false if the console is not powered on.
+    bool startMovieRecording();
+
+    /// \brief Stop recording the movie and write it into a file.
+    ///
+    /// \return true if the movie was written, false otherwise.
+    bool stopMovieRecording(const std::filesystem::path& path);
+
+    /// \brief Replay a movie recorded with the same Game Boy type and cartridge.
+    ///
+    /// The console restores the movie's start state then each runFrame() replays a frame and
+    /// checks its state against the recorded one. The replay stops at the end of the movie.
+    ///
+    /// \return true if the movie plays, false if it cannot be played by this console.
+    bool playMovie(const std::filesystem::path& path);
+
+    /// \brief Is a movie playing?
+    bool isMoviePlaying() const { return m_movieMode == MovieMode::eMOVIEMODE_playing; }
+
+    /// \brief Get the number of replayed frames whose state differs from the recorded one.
+    uint64_t getMovieMismatchesCount() const { return m_movieMismatchesCount; }
+
+    /// \brief Start sampling the code run by the game and tracking the routines it calls.
+    ///
+    /// The samples of a previous profiling are forgotten. The frames emulated ahead are not
+    /// sampled.
+    ///
+    /// \param sampleClocks master clocks between two samples.
+    void startProfiling(const uint32_t sampleClocks);
+
+    /// \brief Stop sampling, the samples are kept until the next start.
+    void stopProfiling();
+
+    /// \brief Record the CPU state of every instruction into a binary trace file (cputrace.h).
+    ///
+    /// A previous trace is closed first. The frames emulated ahead are not traced.
+    ///
+    /// \param path trace file path.
+    ///
+    /// \return true if the trace file was created, false otherwise.
+    bool startTrace(const std::filesystem::path& path);
+
+    /// \brief Write the last instructions and close the trace file.
+    ///
+    /// \return true if the whole trace was written, false on a write error.
+    bool stopTrace();
+
+    /// \brief Get the live metrics of the console, updated after each runFrame().
+    ///
+    /// Any thread may read them while the console runs, e.g. a MetricsExporter.
+    const ConsoleMetrics& getMetrics() const { return m_metrics; }
+
+    /// \brief Get the profiler, nullptr if the console was never profiled.
+    const GuestProfiler* getProfiler() const { return m_profiler.get(); }
+
+    /// \brief Publish the completed frames into a POSIX shared memory segment.
+    ///
+    /// \param segmentName shared memory object name, must start with a '/'.
+    /// \param filter upscaling filter applied to the frames before they are published.
+    ///
+    /// \return true if the segment was created, false otherwise.
+    bool exportFrames(const std::string& segmentName,
+                      const ScaleFilter filter = ScaleFilter::eSCALEFILTER_none);
+
+    /// \brief Get the name of the shared memory segment holding the frames.
+    ///
+    /// \return the segment's name, empty if the frames are not exported.
+    const std::string& getFrameSegmentName() const { return m_frameExporter.getSegmentName(); }
+
+    /// \brief Get the layout of the frames' pixels.
+    PixelFormat getFramePixelFormat() const { return m_frameExporter.getPixelFormat(); }
+
+    /// \brief Record the completed frames into a file, without ever waiting for the disk.
+    ///
+    /// \param path recording file path.
+    /// \param format content of the recording.
+    ///
+    /// \return true if the recording started, false otherwise.
+    bool recordFrames(const std::filesystem::path& path, const RecordFormat format);
+
+    /// \brief Write the pending frames and close the recording file.
+    void stopRecording();
+
+    /// \brief Get the number of frames the recording dropped because the disk was too slow.
+    uint64_t getDroppedRecordedFramesCount() const
+    {
+        return m_frameRecorder.getDroppedFramesCount();
+    }
+
+    /// \brief Compare each frame with the previous one to find the lines and tiles that changed.
+    ///
+    /// The changed lines are also published along with the exported frames.
+    ///
+    /// \param enable true to compare the frames, false to consider them entirely changed.
+    void enableFrameDelta(const bool enable);
+
+    /// \brief Get the changes of the last completed frame.
+    const FrameDelta& getFrameDelta() const { return m_frameDelta; }
+
+    /// \brief Select what the APU emulates.
+    ///
+    /// \param mode eAPUMODE_statusonly when nobody listens: no sample is produced but the games
+    ///             still see the same sound registers.
+    void setAudioMode(const ApuMode mode) { m_apu.setMode(mode); }
+
+    /// \brief Get the queue of the interleaved left/right 16 bits samples played by the APU.
+    ///
+    /// The queue is lock-free, an audio thread may drain it while the console runs.
+    AudioRingBuffer& getAudioOutput() { return m_apu.getOutput(); }
+
+    /// \brief Select the color correction curve applied to the CGB colors.
+    ///
+    /// \param correction color correction curve.
+    void setColorCorrection(const ColorCorrection correction)
+    {
+        m_cgbPalettes.setColorCorrection(correction);
+    }
+
+    /// \brief Get the size of the console's state.
+    size_t getStateSize() const;
+
+    /// \brief Save the console's state into a caller provided buffer, without any allocation.
+    ///
+    /// \param buffer destination of the state.
+    /// \param capacity size of the buffer in bytes, at least getStateSize().
+    ///
+    /// \return the size of the state, 0 if the buffer is too small.
+    size_t saveState(uint8_t* buffer, const size_t capacity) const;
+
+    /// \brief Restore a state saved by a console of the same type running the same cartridge.
+    ///
+    /// The state is checked before anything is restored: on failure the console is untouched.
+    ///
+    /// \param buffer the state.
+    /// \param size size of the state in bytes.
+    ///
+    /// \return true if the state was restored, false otherwise.
+    bool loadState(const uint8_t* buffer, const size_t size);
+
+    /// \brief Copy the console into a new one running from the same state.
+    ///
+    /// The copy shares the cartridge's ROM and gets its own copy of everything else. The host
+    /// side settings (run-ahead, movies, profiling, traces, frame sinks) are not copied.
+    std::unique_ptr<Console> clone() const;
+
+    /// \brief Track the VRAM and WRAM pages written by the game, for reloadState().
+    ///
+    /// \param enable true to track the written pages, false to stop tracking them.
+    void trackWrittenPages(const bool enable);
+
+    /// \brief Restore again the state restored last, copying back only the VRAM and WRAM pages
+    ///        written since then.
+    ///
+    /// The written pages must be tracked since the state was restored, and no other state may
+    /// be restored in between (the run-ahead and the movies restore states). Without tracking,
+    /// the whole state is restored.
+    ///
+    /// \param buffer the state given to the last loadState() or reloadState().
+    /// \param size size of the state in bytes.
+    ///
+    /// \return true if the state was restored, false otherwise.
+    bool reloadState(const uint8_t* buffer, const size_t size);
 
 private:
-    Mmu m_mmu;             ///< Console's Memory management unit.
-    Cpu m_cpu;             ///< Console's CPU.
-    Ppu m_ppu;             ///< Console's PPU.
-    Cartridge m_gameCart;  ///< Game cartridge.
-    bool m_poweredOn;      ///< Is the console powered on?
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the console's state sections.
+    };
+
+    /// \brief What happens to the joypad inputs.
+    enum class MovieMode : uint8_t
+    {
+        eMOVIEMODE_none,       ///< Inputs come from the frontend.
+        eMOVIEMODE_recording,  ///< Inputs come from the frontend and are recorded.
+        eMOVIEMODE_playing     ///< Inputs come from the movie.
+    };
+
+    /// \brief Constructor.
+    ///
+    /// \param type Game Boy's type to emulate.
+    /// \param cart game cartridge.
+    Console(const GBType type, Cartridge&& cart);
+
+    /// \brief Run the console for one CPU cycle.
+    bool stepCycle();
+
+    /// \brief Run a frame, and the frames ahead of it with the run-ahead.
+    bool runDisplayedFrame();
+
+    /// \brief Update the metrics after a frame.
+    ///
+    /// \param hostNs wall time of the frame.
+    /// \param hostCPUNs host CPU time of the frame.
+    void publishMetrics(const uint64_t hostNs, const uint64_t hostCPUNs);
+
+    /// \brief Emulate one frame of the console's timeline.
+    bool emulateFrame();
+
+    /// \brief Apply the movie's inputs due at the current clock.
+    void applyMovieInputs();
+
+    /// \brief Record or check the state at the end of a frame of the movie.
+    void checkMovieFrame();
+
+    /// \brief Take a sample of the running code and schedule the next one.
+    void sampleProfile();
+
+    /// \brief Get the bank mapped at an address, GuestProfiler::eNoBank outside of the ROM.
+    uint16_t getCodeBank(const uint16_t address) const;
+
+    /// \brief Hash the state of the console, except the APU.
+    ///
+    /// The APU's waveform state depends on the audio mode and on how often the audio is caught
+    /// up, none of which the games can observe.
+    uint64_t hashState();
+
+    /// \brief Connect or disconnect the frame sinks and the frame delta from the PPU.
+    void presentFrames(const bool present);
+
+    /// \brief Restore a state, see loadState() and reloadState().
+    ///
+    /// \param writtenPagesOnly true to copy only the written VRAM and WRAM pages.
+    bool restoreState(const uint8_t* buffer, const size_t size, const bool writtenPagesOnly);
+
+    /// \brief Copy back the VRAM and WRAM pages written since the last restored state.
+    ///
+    /// \param vram VRAM banks of the state.
+    /// \param wram WRAM banks of the state.
+    void restoreWrittenPages(const uint8_t* vram, const uint8_t* wram);
+
+    /// \brief Write the state of the console and of its components.
+    void writeState(StateWriter& writer) const;
+
+    /// \brief Route the CGB only I/O registers (VRAM/WRAM banks, palettes) to their handlers.
+    void connectCGBRegisters();
+
+    /// \brief Chain the frame recorder, the scaler and the frame exporter after the PPU.
+    void connectFrameSinks();
+
+    /// \brief Put the console in the state left by the boot ROM.
+    void skipBootROM();
+
+    /// \brief Draw the logo of the cartridge's header into the VRAM, as the boot ROM does.
+    void drawBootLogo();
+
+    /// \brief Map the boot ROM, or the cartridge's first 256 bytes, at 0x0000.
+    void mapBootROM(const bool mapped);
+
+    /// \brief Map the cartridge's ROM at the same addresses, up to the end of a short ROM.
+    ///
+    /// \param startAddr first mapped address.
+    /// \param endAddr address following the last mapped one.
+    void mapCartridgeROM(const uint16_t startAddr, const uint16_t endAddr);
+
+    /// \brief Map a VRAM bank at 0x8000.
+    void mapVRAMBank(const uint8_t bank);
+
+    /// \brief Map a WRAM bank at 0xD000.
+    void mapWRAMBank(const uint8_t bank);
+
+    GBType m_type;            ///< Emulated Game Boy's type.
+    const GBConfig m_config;  ///< Configuration of the emulated Game Boy.
+    Mmu m_mmu;                ///< Console's Memory management unit.
+    Scheduler m_scheduler;    ///< Master clock and timed events.
+    Cpu m_cpu;                ///< Console's CPU.
+    Ppu m_ppu;                ///< Console's PPU.
+    Apu m_apu;                ///< Console's APU.
+    Timer m_timer;            ///< Console's divider and timer.
+    Joypad m_joypad;          ///< Console's joypad.
+    Serial m_serial;          ///< Console's serial port.
+    Cartridge m_gameCart;     ///< Game cartridge.
+    bool m_poweredOn;         ///< Is the console powered on?
+
+    CgbPalettes m_cgbPalettes;      ///< CGB BG and OBJ palettes.
+    FrameExporter m_frameExporter;  ///< Shared memory frames publisher.
+    FrameDelta m_frameDelta;        ///< Changes of the last completed frame.
+    Scaler m_scaler;                ///< Upscales the frames before they are published.
+    std::unique_ptr<ThreadPool> m_scalerThreadPool;  ///< Scales the frames' bands in parallel.
+    FrameRecorder m_frameRecorder;                   ///< Records the frames into a file.
+    bool m_frameDeltaEnabled;                        ///< Are the frames compared?
+
+    uint32_t m_runAheadFrames;             ///< Frames displayed ahead of the timeline.
+    std::vector<uint8_t> m_runAheadState;  ///< State of the timeline while running ahead.
+    std::vector<uint8_t> m_powerOnState;   ///< State restored by reset().
+
+    Movie m_movie;                      ///< Movie being recorded or played.
+    MovieMode m_movieMode;              ///< What happens to the joypad inputs.
+    size_t m_movieInput;                ///< Next input of the movie to play.
+    uint64_t m_movieInputDeadline;      ///< Clock of the next input to play.
+    size_t m_movieFrame;                ///< Next frame of the movie to check.
+    uint64_t m_movieMismatchesCount;    ///< Replayed frames whose state differs.
+    std::vector<uint8_t> m_movieState;  ///< Scratch state used to hash the frames.
+
+    std::unique_ptr<GuestProfiler> m_profiler;   ///< Samples the code run by the game.
+    uint32_t m_profileSampleClocks;              ///< Clocks between two samples.
+    uint64_t m_profileSampleDeadline;            ///< Clock of the next sample.
+    std::unique_ptr<TraceWriter> m_traceWriter;  ///< Records the instructions, if tracing.
+
+    ConsoleMetrics m_metrics;      ///< Live health numbers.
+    uint64_t m_bankSwitchesCount;  ///< VRAM and WRAM bank switches requested by the game.
+
+    uint8_t m_vramBank;    ///< VRAM bank mapped at 0x8000.
+    uint8_t m_wramBank;    ///< WRAM bank mapped at 0xD000.
+    bool m_bootROMMapped;  ///< Is the boot ROM mapped at 0x0000?
+
+    WrittenPages m_writtenPages;  ///< Pages written since the last restored state.
+    bool m_writtenPagesTracked;   ///< Are the written pages tracked?
 
     // =============================================================================================
     //   General Memory Map:
@@ -0,0 +1,116 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      consolearena.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "consolearena.h"
+
+ConsoleArena::ConsoleArena(const Console& root, const size_t capacity, const ForkMode mode) :
+    m_mode(mode), m_snapshotGeneration(0)
+{
+    m_slots.reserve(capacity);
+    m_freeSlots.reserve(capacity);
+    m_slotsIndexes.reserve(capacity);
+    for (size_t slotIdx = 0; slotIdx < capacity; ++slotIdx)
+    {
+        Slot slot{root.clone(), 0, false};
+        slot.console->trackWrittenPages(m_mode == ForkMode::eFORKMODE_writtenPages);
+
+        m_slotsIndexes[slot.console.get()] = slotIdx;
+        m_slots.push_back(std::move(slot));
+    }
+
+    // The first forks take the first slots.
+    for (size_t slotIdx = capacity; slotIdx > 0; --slotIdx)
+    {
+        m_freeSlots.push_back(slotIdx - 1);
+    }
+
+    m_snapshot.resize(root.getStateSize());
+    setSnapshot(root);
+}
+
+// =================================================================================================
+
+bool ConsoleArena::setSnapshot(const Console& root)
+{
+    if ((root.getStateSize() != m_snapshot.size()) ||
+        (root.saveState(m_snapshot.data(), m_snapshot.size()) == 0))
+    {
+        return false;
+    }
+
+    ++m_snapshotGeneration;
+
+    return true;
+}
+
+// =================================================================================================
+
+Console* ConsoleArena::fork()
+{
+    if (m_freeSlots.empty() == true)
+    {
+        return nullptr;
+    }
+
+    Slot& slot = m_slots[m_freeSlots.back()];
+
+    // A console that restored this snapshot last only has to undo its own writes.
+    const bool restored =
+        (slot.snapshotGeneration == m_snapshotGeneration)
+            ? slot.console->reloadState(m_snapshot.data(), m_snapshot.size())
+            : slot.console->loadState(m_snapshot.data(), m_snapshot.size());
+    if (restored == false)
+    {
+        return nullptr;
+    }
+
+    slot.snapshotGeneration = m_snapshotGeneration;
+    slot.forked = true;
+    m_freeSlots.pop_back();
+
+    return slot.console.get();
+}
+
+// =================================================================================================
+
+void ConsoleArena::release(Console* console)
+{
+    const auto slotIt = m_slotsIndexes.find(console);
+    if (slotIt == m_slotsIndexes.end())
+    {
+        return;
+    }
+
+    // Freed twice, the slot would be handed out to two owners.
+    Slot& slot = m_slots[slotIt->second];
+    if (slot.forked == false)
+    {
+        return;
+    }
+
+    slot.forked = false;
+    m_freeSlots.push_back(slotIt->second);
+}
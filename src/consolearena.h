@@ -0,0 +1,101 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      consolearena.h
+///
+/// \brief     Preallocated consoles forked from a snapshot, for search workloads.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef CONSOLEARENA_H_
+#define CONSOLEARENA_H_
+
+#include "console.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/// \brief Consoles forked from a snapshot of a root console, sharing its ROM.
+///
+/// A search explores many input sequences from one game state: setSnapshot() saves the state
+/// once, then each fork() copies it into a preallocated console, without any allocation.
+///
+/// The arena is not thread safe, but the forked consoles may run on different threads.
+class ConsoleArena
+{
+public:
+    /// \brief How fork() copies the snapshot.
+    enum class ForkMode : uint8_t
+    {
+        eFORKMODE_full,  ///< The whole state is copied.
+        eFORKMODE_writtenPages  ///< Only the VRAM and WRAM pages written since the last fork of
+                                ///< the same snapshot are copied back, copy-on-write like.
+    };
+
+    /// \brief Constructor, the snapshot is the root's current state.
+    ///
+    /// \param root console cloned to fill the arena.
+    /// \param capacity number of preallocated consoles.
+    /// \param mode how the snapshot is copied by fork().
+    ConsoleArena(const Console& root, const size_t capacity, const ForkMode mode);
+
+    /// \brief Save the state forked by the next fork() calls.
+    ///
+    /// \param root a console of the same type running the same cartridge as the arena's root.
+    ///
+    /// \return true if the state was saved, false otherwise.
+    bool setSnapshot(const Console& root);
+
+    /// \brief Copy the snapshot into a free console.
+    ///
+    /// \return the console, nullptr if all the consoles are forked.
+    Console* fork();
+
+    /// \brief Give a forked console back to the arena.
+    ///
+    /// A console that is not forked, or already released, is ignored.
+    void release(Console* console);
+
+    /// \brief Get the number of preallocated consoles.
+    size_t getCapacity() const { return m_slots.size(); }
+
+    /// \brief Get the number of consoles that can be forked.
+    size_t getFreeCount() const { return m_freeSlots.size(); }
+
+private:
+    /// \brief A preallocated console.
+    struct Slot
+    {
+        std::unique_ptr<Console> console;  ///< The console.
+        uint64_t snapshotGeneration;       ///< Snapshot restored last, 0 if none.
+        bool forked;                       ///< Is the console handed out by fork()?
+    };
+
+    ForkMode m_mode;                                            ///< How the snapshot is copied.
+    std::vector<Slot> m_slots;                                  ///< Preallocated consoles.
+    std::vector<size_t> m_freeSlots;                            ///< Slots that can be forked.
+    std::unordered_map<const Console*, size_t> m_slotsIndexes;  ///< Slot of each console.
+    std::vector<uint8_t> m_snapshot;                            ///< State copied by fork().
+    uint64_t m_snapshotGeneration;                              ///< Incremented by each snapshot.
+};
+
+#endif /* CONSOLEARENA_H_ */
@@ -33,14 +33,16 @@
 #include <thread>
 
 // Local includes.
+#include "opcodeprofile.h"
 #include "utils.h"
 
 Cpu::Cpu(Mmu& mmu) :
-    A(m_registers[1]), B(m_registers[3]), C(m_registers[2]), D(m_registers[5]), E(m_registers[4]),
-    F(m_registers[0]), H(m_registers[7]), L(m_registers[6]), AF(reinterpret_cast<uint16_t&>(F)),
+    m_registers{}, A(m_registers[1]), B(m_registers[3]), C(m_registers[2]), D(m_registers[5]),
+    E(m_registers[4]), F(m_registers[0]), H(m_registers[7]), L(m_registers[6]),
+    AF(reinterpret_cast<uint16_t&>(F)),
     BC(reinterpret_cast<uint16_t&>(C)), DE(reinterpret_cast<uint16_t&>(E)),
     HL(reinterpret_cast<uint16_t&>(L)), SP(reinterpret_cast<uint16_t&>(m_registers[8])),
-    PC(reinterpret_cast<uint16_t&>(m_registers[10])), IME(true), m_mmu(mmu),
+    PC(reinterpret_cast<uint16_t&>(m_registers[10])), IR(0), MBR{}, IME(true), m_mmu(mmu),
     m_cpuCycleState(InstructionCycleState::eCYCLE_fetch), m_unfinishedLastOp(false),
     m_inPrefixCBOp(false)
 {
@@ -48,80 +50,117 @@ Cpu::Cpu(Mmu& mmu) :
     PC = MemoryAreas::eMEMADDR_rombank0start;
 
     // Map the CPU's ROM to the internal memory at address 0x0.
-    m_mmu.mapDataBufferToMemory(m_CPUROM, MemoryAreas::eMEMADDR_rombank0start);
+    mapBootROM();
 }
 
 // =================================================================================================
 
-bool Cpu::checkForInterrupts()
+void Cpu::setPostBootState(const uint16_t af,
+                           const uint16_t bc,
+                           const uint16_t de,
+                           const uint16_t hl)
 {
-    const std::bitset<8> interruptFlagsReg(m_mmu.readByte(HardwareIORegisters::eIOREG_if) & 0x1F);
-    const std::bitset<8> interruptEnableReg(m_mmu.readByte(MemoryAreas::eMEMADDR_eireg) & 0x1F);
-
-    const uint16_t oldPC = PC;
-
-    if (IME == true)
-    {
-        if ((interruptFlagsReg == true) && (interruptEnableReg == true))
-        {
-            if ((interruptFlagsReg.to_ulong() == 0x01) && (interruptEnableReg.to_ulong() == 0x01))
-            {
-                // LCD V-Blank interrupt.
-
-                execPUSH(PC);
+    AF = af;
+    BC = bc;
+    DE = de;
+    HL = hl;
+    SP = 0xFFFE;
+    PC = MemoryAreas::eMEMADDR_cartridgeheaderstart;
+    IME = false;
+}
 
-                PC = InterruptAddresses::eINTADDR_vblank;
-            }
+// =================================================================================================
 
-            if ((interruptFlagsReg.to_ulong() == 0x02) && (interruptEnableReg.to_ulong() == 0x02))
-            {
-                // LCD stat interrupt.
+void Cpu::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_cpu, eStateVersion);
+
+    writer.write(m_registers);
+    writer.write(IR);
+    writer.write(MBR);
+    writer.write(IME);
+    writer.write(m_currentInstructionAddr);
+    writer.write(m_opLength);
+    writer.write(m_cpuCycles);
+    writer.write(m_cpuCycleState);
+    writer.write(m_unfinishedLastOpData);
+    writer.write(m_unfinishedLastOp);
+    writer.write(m_inPrefixCBOp);
+
+    writer.endSection();
+}
 
-                execPUSH(PC);
+// =================================================================================================
 
-                PC = InterruptAddresses::eINTADDR_lcdstat;
-            }
+bool Cpu::loadState(StateReader& reader)
+{
+    return (reader.openSection(savestate::eSECTION_cpu) == true) && reader.read(m_registers) &&
+           reader.read(IR) && reader.read(MBR) && reader.read(IME) &&
+           reader.read(m_currentInstructionAddr) && reader.read(m_opLength) &&
+           reader.read(m_cpuCycles) && reader.read(m_cpuCycleState) &&
+           reader.read(m_unfinishedLastOpData) && reader.read(m_unfinishedLastOp) &&
+           reader.read(m_inPrefixCBOp);
+}
 
-            if ((interruptFlagsReg.to_ulong() == 0x04) && (interruptEnableReg.to_ulong() == 0x04))
-            {
-                // Timer interrupt.
+// =================================================================================================
 
-                execPUSH(PC);
+bool Cpu::checkForInterrupts()
+{
+    // 2nd cycle of a dispatch: the return address pushed by the 1st one is complete.
+    if (m_unfinishedLastOp == true)
+    {
+        execPUSH(PC);
+        switchState();
 
-                PC = InterruptAddresses::eINTADDR_timer;
-            }
+        return false;
+    }
 
-            if ((interruptFlagsReg.to_ulong() == 0x08) && (interruptEnableReg.to_ulong() == 0x08))
-            {
-                // Serial interrupt.
+    const uint8_t requestedInterrupts = m_mmu.readByte(HardwareIORegisters::eIOREG_if) &
+                                        m_mmu.readByte(MemoryAreas::eMEMADDR_eireg) & 0x1F;
+    if ((IME == false) || (requestedInterrupts == 0))
+    {
+        switchState();
 
-                execPUSH(PC);
+        return false;
+    }
 
-                PC = InterruptAddresses::eINTADDR_serial;
-            }
+    // The lowest requested bit has the highest priority: V-Blank, LCD STAT, timer, serial then
+    // joypad, whose vectors are 8 bytes apart.
+    uint8_t interruptIdx = 0;
+    while ((requestedInterrupts & (1 << interruptIdx)) == 0)
+    {
+        ++interruptIdx;
+    }
 
-            if ((interruptFlagsReg.to_ulong() == 0x10) && (interruptEnableReg.to_ulong() == 0x10))
-            {
-                // Joypad interrupt.
+    // The serviced request is acknowledged and the other ones wait for the next RETI or EI.
+    m_mmu.writeByte(m_mmu.readByte(HardwareIORegisters::eIOREG_if) & ~(1 << interruptIdx),
+                    HardwareIORegisters::eIOREG_if);
+    disableInterrupts();
 
-                execPUSH(PC);
+    execPUSH(PC);
+    PC = InterruptAddresses::eINTADDR_vblank + (interruptIdx * 8);
 
-                PC = InterruptAddresses::eINTADDR_joypad;
-            }
-        }
+    // The dispatch is reported once, when PC jumps to the vector: the push ends a cycle later.
+    ++m_interruptsCount;
+    if (m_callTracer != nullptr)
+    {
+        m_callTracer->enterRoutine(PC, SP);
     }
 
     switchState();
 
-    return oldPC != PC;
+    return true;
 }
 
 // =================================================================================================
 
 void Cpu::waitForInterrupt()
 {
-    while (checkForInterrupts() == false)
+    const uint8_t requestedInterrupts = m_mmu.readByte(HardwareIORegisters::eIOREG_if) &
+                                        m_mmu.readByte(MemoryAreas::eMEMADDR_eireg) & 0x1F;
+    if (requestedInterrupts != 0)
     {
+        switchState();
     }
 }
 
@@ -131,6 +170,7 @@ void Cpu::fetch()
 {
     // Fetch the next instruction from memory into IR.
     IR = fetchNextByte();
+    ++m_instructionsCount;
 
     // Get the length of the fetched instruction.
     if (m_inPrefixCBOp == false)
@@ -146,6 +186,16 @@ void Cpu::fetch()
     // Save the current address pointer by PC.
     m_currentInstructionAddr = PC;
 
+    // The prefix CB instructions are recorded with their 0xCB prefix.
+    if ((m_instructionTracer != nullptr) && (m_inPrefixCBOp == false))
+    {
+        traceInstruction();
+    }
+
+#ifdef COLORBOY_OPCODE_PROFILE
+    m_instructionStartCycle = m_cpuCycles;
+#endif
+
     // Advance PC to point to the next instruction in memory.
     PC += m_opLength;
 
@@ -189,6 +239,10 @@ void Cpu::execute()
 {
     // Call the current CPU instruction's method.
 
+#ifdef COLORBOY_OPCODE_PROFILE
+    const bool prefixCBOp = m_inPrefixCBOp;
+#endif
+
     if (m_inPrefixCBOp == false)
     {
         m_opsFunctions[IR]();
@@ -199,7 +253,19 @@ void Cpu::execute()
         m_opsPrefixCBFunctions[IR]();
     }
 
-    switchState();
+#ifdef COLORBOY_OPCODE_PROFILE
+    // Count the instruction once, when its last execute cycle is done.
+    if (m_unfinishedLastOp == false)
+    {
+        OpcodeProfile::record(prefixCBOp, IR, ((m_cpuCycles - m_instructionStartCycle) / 4) + 1);
+    }
+#endif
+
+    // HALT stops the CPU instead.
+    if (m_cpuCycleState == InstructionCycleState::eCYCLE_execute)
+    {
+        switchState();
+    }
 }
 
 // =================================================================================================
@@ -235,6 +301,8 @@ void Cpu::switchState(const InstructionCycleState state)
 
 bool Cpu::cycle()
 {
+    ++m_cyclesCount;
+
     const InstructionCycleState lastCpuCycleState = m_cpuCycleState;
     switch (m_cpuCycleState)
     {
@@ -242,7 +310,10 @@ bool Cpu::cycle()
     case InstructionCycleState::eCYCLE_fetch: fetch(); break;
     case InstructionCycleState::eCYCLE_decode: decode(); break;
     case InstructionCycleState::eCYCLE_execute: execute(); break;
-    case InstructionCycleState::eCYCLE_stop: waitForInterrupt(); break;
+    case InstructionCycleState::eCYCLE_stop:
+        ++m_stoppedCyclesCount;
+        waitForInterrupt();
+        break;
     }
 
     // There must be an operation which took more that one CPU cycle.
@@ -251,10 +322,7 @@ bool Cpu::cycle()
         m_cpuCycleState = lastCpuCycleState;
     }
 
-    if (m_cpuCycles == GBConfig::clockFrequency)
-    {
-        m_cpuCycles = 0;
-    }
+    // The counter wraps around at 2^32, a multiple of 4: the PPU's cycles differences stay exact.
     m_cpuCycles += 4;
 
     return true;
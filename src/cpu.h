@@ -28,11 +28,13 @@
 #ifndef CPU_H_
 #define CPU_H_
 
+#include "calltracer.h"
 #include "mmu.h"
+#include "savestate.h"
+#include "instructiontracer.h"
 
 #include <cstdint>
 #include <array>
-#include <stack>
 #include <bitset>
 #include <functional>
 
@@ -55,7 +57,68 @@ public:
     /// \return the current CPU cycle.
     uint32_t getCurrentCPUCycle() const { return m_cpuCycles; }
 
+    /// \brief Get the number of cycles run since the CPU was created.
+    uint64_t getCyclesCount() const { return m_cyclesCount; }
+
+    /// \brief Get the number of instructions fetched since the CPU was created.
+    uint64_t getInstructionsCount() const { return m_instructionsCount; }
+
+    /// \brief Get the number of interrupts dispatched since the CPU was created.
+    uint64_t getInterruptsCount() const { return m_interruptsCount; }
+
+    /// \brief Get the number of cycles spent stopped since the CPU was created.
+    uint64_t getStoppedCyclesCount() const { return m_stoppedCyclesCount; }
+
+    /// \brief Get the address of the instruction being run.
+    uint16_t getCurrentInstructionAddress() const { return m_currentInstructionAddr; }
+
+    /// \brief Report the routines entered and left to a tracer.
+    ///
+    /// \param callTracer the tracer, nullptr to stop tracing.
+    void setCallTracer(CallTracer* callTracer) { m_callTracer = callTracer; }
+
+    /// \brief Report the state of each instruction to a tracer.
+    ///
+    /// \param instructionTracer the tracer, nullptr to stop tracing.
+    void setInstructionTracer(InstructionTracer* instructionTracer)
+    {
+        m_instructionTracer = instructionTracer;
+    }
+
+    /// \brief Map the boot ROM at 0x0000, on top of the cartridge's first 256 bytes.
+    void mapBootROM()
+    {
+        m_mmu.mapDataBufferToMemory(m_CPUROM, MemoryAreas::eMEMADDR_rombank0start);
+    }
+
+    /// \brief Get the boot ROM.
+    const std::array<uint8_t, 256>& getBootROM() const { return m_CPUROM; }
+
+    /// \brief Set the registers as the boot ROM leaves them when it jumps to the cartridge.
+    ///
+    /// \param af value of AF, tells the games on which Game Boy type they run.
+    /// \param bc value of BC.
+    /// \param de value of DE.
+    /// \param hl value of HL.
+    void setPostBootState(const uint16_t af,
+                          const uint16_t bc,
+                          const uint16_t de,
+                          const uint16_t hl);
+
+    /// \brief Write the CPU state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the CPU state.
+    ///
+    /// \return true if the state holds the CPU section, false otherwise.
+    bool loadState(StateReader& reader);
+
 private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
     // =============================================================================================
     // Gameboy CPU (Sharp LR35902) instruction set.
     // =============================================================================================
@@ -628,6 +691,24 @@ private:
     /// \param status New bit values.
     void setFlagRegisterBytes(const uint8_t status) { flagReg = status; }
 
+    /// \brief Bytes an op spanning several cycles keeps between them, at most 2.
+    class UnfinishedOpData
+    {
+    public:
+        void push(const uint8_t byte)
+        {
+            CBASSERT(m_count < m_bytes.size(), "Unfinished op data overflow");
+            m_bytes[m_count++] = byte;
+        }
+
+        uint8_t top() const { return m_bytes[m_count - 1]; }
+        void pop() { --m_count; }
+        bool empty() const { return m_count == 0; }
+
+        std::array<uint8_t, 2> m_bytes = {0, 0};  ///< Pushed bytes, from the bottom.
+        uint8_t m_count = 0;                      ///< Number of pushed bytes.
+    };
+
     /// \brief Representation of the CPU state.
     enum class InstructionCycleState : uint8_t
     {
@@ -647,9 +728,33 @@ private:
     /// \brief Check if there are activated interrupts.
     bool checkForInterrupts();
 
-    /// \brief Stop the CPU until an interrupt occurs.
+    /// \brief Leave the stop state once an enabled interrupt is requested, even if IME is off.
     void waitForInterrupt();
 
+    /// \brief Report the routine entered by a completed CALL or RST to the call tracer.
+    void traceCall()
+    {
+        if ((m_callTracer != nullptr) && (m_unfinishedLastOp == false))
+        {
+            m_callTracer->enterRoutine(PC, SP);
+        }
+    }
+
+    /// \brief Report a completed RET to the call tracer.
+    void traceReturn()
+    {
+        if ((m_callTracer != nullptr) && (m_unfinishedLastOp == false))
+        {
+            m_callTracer->leaveRoutine(SP);
+        }
+    }
+
+    /// \brief Report the fetched instruction and the registers before it runs to the tracer.
+    void traceInstruction()
+    {
+        m_instructionTracer->traceInstruction({m_cpuCycles, PC, SP, A, F, B, C, D, E, H, L, IR});
+    }
+
     /// \brief Fetch the next instruction from memory.
     void fetch();
 
@@ -776,12 +881,25 @@ private:
     uint8_t m_opLength = 0;    ///< Current instruction length.
     uint32_t m_cpuCycles = 0;  ///< Total CPU cycles.
 
-    InstructionCycleState m_cpuCycleState;       ///< Current CPU cycle state.
-    std::stack<uint8_t> m_unfinishedLastOpData;  ///< Any data left from an unfinished op.
-    bool m_unfinishedLastOp;                     ///< Is the last CPU op completed?
+    InstructionCycleState m_cpuCycleState;    ///< Current CPU cycle state.
+    UnfinishedOpData m_unfinishedLastOpData;  ///< Any data left from an unfinished op.
+    bool m_unfinishedLastOp;                  ///< Is the last CPU op completed?
 
     bool m_inPrefixCBOp;  ///< Is a prefix CB op running?
 
+    CallTracer* m_callTracer = nullptr;                ///< Gets the routines entered and left.
+    InstructionTracer* m_instructionTracer = nullptr;  ///< Gets the state of each instruction.
+
+    // Metrics, not part of the state.
+    uint64_t m_cyclesCount = 0;         ///< Cycles run.
+    uint64_t m_instructionsCount = 0;   ///< Instructions fetched.
+    uint64_t m_interruptsCount = 0;     ///< Interrupts dispatched.
+    uint64_t m_stoppedCyclesCount = 0;  ///< Cycles spent stopped.
+
+#ifdef COLORBOY_OPCODE_PROFILE
+    uint32_t m_instructionStartCycle = 0;  ///< CPU cycle of the current instruction's fetch.
+#endif
+
     std::array<uint8_t, 256> m_CPUROM =
         {0x31, 0xFE, 0xFF, 0xAF, 0x21, 0xFF, 0x9F, 0x32, 0xCB, 0x7C, 0x20, 0xFB, 0x21, 0x26, 0xFF,
          0x0E, 0x11, 0x3E, 0x80, 0x32, 0xE2, 0x0C, 0x3E, 0xF3, 0xE2, 0x32, 0x3E, 0x77, 0x77, 0x3E,
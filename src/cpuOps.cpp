@@ -29,19 +29,21 @@
 
 void Cpu::execPUSH(const uint16_t word)
 {
-    // 1st cycle.
+    // 1st cycle. The callers may have changed the pushed register before the 2nd one.
     if (m_unfinishedLastOp == false)
     {
         SP -= 2;
 
         loadByteToAddress(word & 0xFF, SP);
+        m_unfinishedLastOpData.push(word >> 8);
         m_unfinishedLastOp = true;
 
         return;
     }
 
     // 2nd cycle.
-    loadByteToAddress(word >> 8, SP + 1);
+    loadByteToAddress(m_unfinishedLastOpData.top(), SP + 1);
+    m_unfinishedLastOpData.pop();
     m_unfinishedLastOp = false;
 }
 
@@ -94,7 +96,7 @@ void Cpu::op_LD__BC__A()
 {
     loadByteToAddress(A, BC);
 
-    PRINTOP("LD BC, A", {});
+    PRINTOP("LD (BC), A", {});
 }
 
 // =================================================================================================
@@ -206,7 +208,7 @@ void Cpu::op_LD_A__BC__()
 {
     A = fetchByteFromAddress(BC);
 
-    PRINTOP("ADD A, (BC)", {});
+    PRINTOP("LD A, (BC)", {});
 }
 
 // =================================================================================================
@@ -277,6 +279,8 @@ void Cpu::op_RRCA()
 
 void Cpu::op_STOP()
 {
+    // Stopped like HALT until an enabled interrupt is requested, e.g. the joypad's. The CGB speed
+    // switch is not emulated.
     switchState(InstructionCycleState::eCYCLE_stop);
 
     PRINTOP("STOP", {});
@@ -352,13 +356,13 @@ void Cpu::op_LD_D_d8()
 
 void Cpu::op_RLA()
 {
-    const bool bit7 = hasCarry(A);
+    const bool bit7 = ((A & 0x80) == 0x80);
     A <<= 1;
     A |= static_cast<uint8_t>(checkFlagRegisterBit(FlagRegisterBits::eCarryFlag));
 
-    // Old bit 7 to Carry flag.
+    // Old bit 7 to Carry flag, unlike RL A the zero flag is always reset.
     setFlagRegisterBit(FlagRegisterBits::eCarryFlag, bit7);
-    setFlagRegisterBit(FlagRegisterBits::eZeroFlag, (A == 0));
+    setFlagRegisterBit(FlagRegisterBits::eZeroFlag, false);
     setFlagRegisterBit(FlagRegisterBits::eSubtractFlag, false);
     setFlagRegisterBit(FlagRegisterBits::eHalfCarryFlag, false);
 
@@ -619,7 +623,7 @@ void Cpu::op_LD_A__HLplus__()
     A = fetchByteFromAddress(HL);
     ++HL;
 
-    PRINTOP("ADD A, (HL+)", {});
+    PRINTOP("LD A, (HL+)", {});
 }
 
 // =================================================================================================
@@ -1394,7 +1398,8 @@ void Cpu::op_LD__HL__L()
 
 void Cpu::op_HALT()
 {
-    waitForInterrupt();
+    // Stopped from the next cycle, the other components keep running and may wake the CPU up.
+    switchState(InstructionCycleState::eCYCLE_stop);
 
     PRINTOP("HALT", {});
 }
@@ -2633,6 +2638,7 @@ void Cpu::op_RET_NZ()
     if (checkFlagRegisterBit(FlagRegisterBits::eZeroFlag) == false)
     {
         PC = execPOP();
+        traceReturn();
     }
 
     PRINTOP("RET NZ", {});
@@ -2677,6 +2683,7 @@ void Cpu::op_CALL_NZ_a16()
         execPUSH(PC);
 
         PC = cbutil::combineTwoBytes(MBR[0], MBR[1]);
+        traceCall();
     }
 
     PRINTOP("CALL NZ, $%x", {PC});
@@ -2716,9 +2723,10 @@ void Cpu::op_ADD_A_d8()
 
 void Cpu::op_RST_00H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x0;
+    traceCall();
 
     PRINTOP("RST 00H", {});
 }
@@ -2730,6 +2738,7 @@ void Cpu::op_RET_Z()
     if (checkFlagRegisterBit(FlagRegisterBits::eZeroFlag) == true)
     {
         PC = execPOP();
+        traceReturn();
     }
 
     PRINTOP("RET Z", {});
@@ -2740,6 +2749,7 @@ void Cpu::op_RET_Z()
 void Cpu::op_RET()
 {
     PC = execPOP();
+    traceReturn();
 
     PRINTOP("RET", {});
 }
@@ -2772,6 +2782,7 @@ void Cpu::op_CALL_Z_a16()
         execPUSH(PC);
 
         PC = cbutil::combineTwoBytes(MBR[0], MBR[1]);
+        traceCall();
     }
 
     PRINTOP("CALL Z, $%x", {PC});
@@ -2784,6 +2795,7 @@ void Cpu::op_CALL_a16()
     execPUSH(PC);
 
     PC = cbutil::combineTwoBytes(MBR[0], MBR[1]);
+    traceCall();
 
     PRINTOP("CALL $%x", {PC});
 }
@@ -2818,9 +2830,10 @@ void Cpu::op_ADC_A_d8()
 
 void Cpu::op_RST_08H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x8;
+    traceCall();
 
     PRINTOP("RST 08H", {});
 }
@@ -2832,6 +2845,7 @@ void Cpu::op_RET_NC()
     if (checkFlagRegisterBit(FlagRegisterBits::eCarryFlag) == false)
     {
         PC = execPOP();
+        traceReturn();
     }
 
     PRINTOP("RET NC", {});
@@ -2867,6 +2881,7 @@ void Cpu::op_CALL_NC_a16()
         execPUSH(PC);
 
         PC = cbutil::combineTwoBytes(MBR[0], MBR[1]);
+        traceCall();
     }
 
     PRINTOP("CALL NC, $%x", {cbutil::combineTwoBytes(MBR[0], MBR[1])});
@@ -2906,9 +2921,10 @@ void Cpu::op_SUB_d8()
 
 void Cpu::op_RST_10H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x10;
+    traceCall();
 
     PRINTOP("RST 10H", {});
 }
@@ -2920,6 +2936,7 @@ void Cpu::op_RET_C()
     if (checkFlagRegisterBit(FlagRegisterBits::eCarryFlag) == true)
     {
         PC = execPOP();
+        traceReturn();
     }
 
     PRINTOP("RET C", {});
@@ -2930,6 +2947,7 @@ void Cpu::op_RET_C()
 void Cpu::op_RETI()
 {
     PC = execPOP();
+    traceReturn();
 
     enableInterrupts();
 
@@ -2957,6 +2975,7 @@ void Cpu::op_CALL_C_a16()
         execPUSH(PC);
 
         PC = cbutil::combineTwoBytes(MBR[0], MBR[1]);
+        traceCall();
     }
 
     PRINTOP("CALL C, $%x", {cbutil::combineTwoBytes(MBR[0], MBR[1])});
@@ -2990,9 +3009,10 @@ void Cpu::op_SBC_A_d8()
 
 void Cpu::op_RST_18H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x18;
+    traceCall();
 
     PRINTOP("RST 18H", {});
 }
@@ -3055,9 +3075,10 @@ void Cpu::op_AND_d8()
 
 void Cpu::op_RST_20H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x20;
+    traceCall();
 
     PRINTOP("RST 20H", {});
 }
@@ -3068,10 +3089,12 @@ void Cpu::op_ADD_SP_r8()
 {
     const uint8_t byte = MBR[0];
 
-    const bool halfCarry = hasHalfCarry(A, byte);
-    const bool carry = hasCarry(A, byte);
+    // The flags come from the unsigned addition to SP's low byte, the offset is signed.
+    const uint8_t spLowByte = SP & 0xFF;
+    const bool halfCarry = hasHalfCarry(spLowByte, byte);
+    const bool carry = hasCarry(spLowByte, byte);
 
-    SP += byte;
+    SP += static_cast<int8_t>(byte);
 
     setFlagRegisterBit(FlagRegisterBits::eCarryFlag, carry);
     setFlagRegisterBit(FlagRegisterBits::eHalfCarryFlag, halfCarry);
@@ -3119,9 +3142,10 @@ void Cpu::op_XOR_d8()
 
 void Cpu::op_RST_28H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x28;
+    traceCall();
 
     PRINTOP("RST 28H", {});
 }
@@ -3140,7 +3164,8 @@ void Cpu::op_LDH_A__a8__()
 
 void Cpu::op_POP_AF()
 {
-    AF = execPOP();
+    // The low nibble of F does not exist, it always reads 0.
+    AF = execPOP() & 0xFFF0;
 
     PRINTOP("POP AF", {});
 }
@@ -3192,9 +3217,10 @@ void Cpu::op_OR_d8()
 
 void Cpu::op_RST_30H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x30;
+    traceCall();
 
     PRINTOP("RST 30H", {});
 }
@@ -3266,9 +3292,10 @@ void Cpu::op_CP_d8()
 
 void Cpu::op_RST_38H()
 {
-    execPUSH(m_currentInstructionAddr);
+    execPUSH(PC);
 
     PC = 0x38;
+    traceCall();
 
     PRINTOP("RST 38H", {});
 }
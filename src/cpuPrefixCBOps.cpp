@@ -58,7 +58,7 @@ void Cpu::execRRC(uint8_t& data)
 
 void Cpu::execRL(uint8_t& data)
 {
-    const bool bit7 = hasCarry(data);
+    const bool bit7 = ((data & 0x80) == 0x80);
     data <<= 1;
     data |= static_cast<uint8_t>(checkFlagRegisterBit(FlagRegisterBits::eCarryFlag));
 
@@ -936,7 +936,7 @@ void Cpu::op_BIT_2_C()
 {
     execBIT(C, 2);
 
-    PRINTOP("BIT Z, C", {});
+    PRINTOP("BIT 2, C", {});
 }
 
 // =================================================================================================
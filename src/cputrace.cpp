@@ -0,0 +1,206 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      cputrace.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "cputrace.h"
+
+#include <array>
+
+namespace
+{
+using EncodedRecord = std::array<uint8_t, cputrace::eEncodedRecordSize>;
+
+/// \brief Write the fields of a record into its fixed-width layout, the cycle apart.
+void storeFields(const cputrace::Record& record, EncodedRecord& bytes)
+{
+    bytes = {static_cast<uint8_t>(record.pc),
+             static_cast<uint8_t>(record.pc >> 8),
+             static_cast<uint8_t>(record.sp),
+             static_cast<uint8_t>(record.sp >> 8),
+             record.a,
+             record.f,
+             record.b,
+             record.c,
+             record.d,
+             record.e,
+             record.h,
+             record.l,
+             record.opcode,
+             0,
+             0,
+             0};
+}
+
+/// \brief Read the fields of a record from its fixed-width layout, the cycle apart.
+void loadFields(const EncodedRecord& bytes, cputrace::Record& record)
+{
+    record.pc = bytes[0] | (bytes[1] << 8);
+    record.sp = bytes[2] | (bytes[3] << 8);
+    record.a = bytes[4];
+    record.f = bytes[5];
+    record.b = bytes[6];
+    record.c = bytes[7];
+    record.d = bytes[8];
+    record.e = bytes[9];
+    record.h = bytes[10];
+    record.l = bytes[11];
+    record.opcode = bytes[12];
+}
+
+}  // namespace
+
+namespace cputrace
+{
+uint32_t encodeBlock(const Record* records,
+                     const uint32_t count,
+                     BlockHeader& header,
+                     std::vector<uint8_t>& output)
+{
+    // The block ends before the first cycle jump.
+    uint32_t blockRecords = 1;
+    while ((blockRecords < count) &&
+           (records[blockRecords].cycle - records[blockRecords - 1].cycle <= 0xFFFF))
+    {
+        ++blockRecords;
+    }
+
+    // Delta encoding, the planes are filled in place.
+    std::vector<uint8_t> planes(static_cast<size_t>(blockRecords) * eEncodedRecordSize);
+    EncodedRecord previous{};
+    EncodedRecord current;
+    uint32_t previousCycle = records[0].cycle;
+    for (uint32_t idx = 0; idx < blockRecords; ++idx)
+    {
+        const Record& record = records[idx];
+        const uint32_t cycleDelta = record.cycle - previousCycle;
+
+        storeFields(record, current);
+        for (uint32_t byte = 0; byte < eEncodedRecordSize - 2; ++byte)
+        {
+            planes[(byte * blockRecords) + idx] = current[byte] ^ previous[byte];
+        }
+        planes[((eEncodedRecordSize - 2) * blockRecords) + idx] = cycleDelta & 0xFF;
+        planes[((eEncodedRecordSize - 1) * blockRecords) + idx] = cycleDelta >> 8;
+
+        previous = current;
+        previousCycle = record.cycle;
+    }
+
+    // Zero runs of each plane.
+    output.clear();
+    for (uint32_t byte = 0; byte < eEncodedRecordSize; ++byte)
+    {
+        const uint8_t* plane = &planes[byte * blockRecords];
+        for (uint32_t idx = 0; idx < blockRecords;)
+        {
+            if (plane[idx] != 0)
+            {
+                output.push_back(plane[idx]);
+                ++idx;
+                continue;
+            }
+
+            uint32_t run = 1;
+            while ((idx + run < blockRecords) && (run < 256) && (plane[idx + run] == 0))
+            {
+                ++run;
+            }
+            output.push_back(0);
+            output.push_back(static_cast<uint8_t>(run - 1));
+            idx += run;
+        }
+    }
+
+    header.recordsCount = blockRecords;
+    header.compressedSize = static_cast<uint32_t>(output.size());
+    header.firstCycle = records[0].cycle;
+    header.reserved = 0;
+
+    return blockRecords;
+}
+
+// =================================================================================================
+
+bool decodeBlock(const BlockHeader& header, const uint8_t* data, std::vector<Record>& records)
+{
+    const uint32_t count = header.recordsCount;
+    if ((count == 0) || (count > eBlockRecords))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> planes(static_cast<size_t>(count) * eEncodedRecordSize);
+    const uint8_t* const end = data + header.compressedSize;
+    for (size_t pos = 0; pos < planes.size();)
+    {
+        if (data == end)
+        {
+            return false;
+        }
+
+        if (*data != 0)
+        {
+            planes[pos++] = *data++;
+            continue;
+        }
+
+        if (data + 1 == end)
+        {
+            return false;
+        }
+        const uint32_t run = data[1] + 1;
+        data += 2;
+
+        // The runs never span two planes.
+        if ((pos % count) + run > count)
+        {
+            return false;
+        }
+        pos += run;  // The planes are zero filled.
+    }
+    if (data != end)
+    {
+        return false;
+    }
+
+    records.resize(count);
+    EncodedRecord current{};
+    uint32_t cycle = header.firstCycle;
+    for (uint32_t idx = 0; idx < count; ++idx)
+    {
+        for (uint32_t byte = 0; byte < eEncodedRecordSize - 2; ++byte)
+        {
+            current[byte] ^= planes[(byte * count) + idx];
+        }
+        cycle += planes[((eEncodedRecordSize - 2) * count) + idx] |
+                 (planes[((eEncodedRecordSize - 1) * count) + idx] << 8);
+
+        loadFields(current, records[idx]);
+        records[idx].cycle = cycle;
+    }
+
+    return true;
+}
+
+}  // namespace cputrace
@@ -0,0 +1,119 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      cputrace.h
+///
+/// \brief     Binary format of the CPU instruction traces.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef CPUTRACE_H_
+#define CPUTRACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// =================================================================================================
+//   Trace file:
+//
+// FileHeader, then blocks of up to eBlockRecords instructions, each one a BlockHeader followed by
+// its compressed records. The blocks are independent from each other.
+//
+// Encoding of a block:
+// 1. Each Record becomes a fixed-width 16 bytes EncodedRecord: the registers, SP, PC and opcode
+//    are XORed with the previous record's, the cycle is the difference with the previous one.
+//    The block's first record is compared with zeros and the header holds its cycle. A cycle
+//    difference above 0xFFFF (e.g. after a state was loaded) starts a new block.
+// 2. The records are transposed into 16 planes: all the records' byte 0, then byte 1, etc.
+// 3. Each plane's zeros are run-length encoded: a non-zero byte is itself, a 0x00 byte is
+//    followed by the run's length minus one (1 to 256 zeros).
+// =================================================================================================
+
+namespace cputrace
+{
+enum : uint32_t
+{
+    eMagic = 0x52544243,      ///< "CBTR" in the file.
+    eVersion = 1,             ///< Format version, bumped on every incompatible change.
+    eBlockRecords = 0x10000,  ///< Maximum records per block.
+    eEncodedRecordSize = 16   ///< Size of a delta-encoded record.
+};
+
+/// \brief The CPU state at the start of an instruction.
+struct Record
+{
+    uint32_t cycle;  ///< CPU cycle counter (4 per cycle) when the instruction is fetched.
+    uint16_t pc;     ///< Instruction's address.
+    uint16_t sp;     ///< Stack pointer.
+    uint8_t a;       ///< Register A.
+    uint8_t f;       ///< Flags register.
+    uint8_t b;       ///< Register B.
+    uint8_t c;       ///< Register C.
+    uint8_t d;       ///< Register D.
+    uint8_t e;       ///< Register E.
+    uint8_t h;       ///< Register H.
+    uint8_t l;       ///< Register L.
+    uint8_t opcode;  ///< Instruction's first byte, 0xCB for the prefix CB instructions.
+};
+
+/// \brief Header at the start of the file.
+struct FileHeader
+{
+    uint32_t magic;       ///< Always eMagic.
+    uint32_t version;     ///< Always eVersion.
+    uint32_t recordSize;  ///< Always eEncodedRecordSize.
+    uint32_t reserved;    ///< Always 0.
+};
+
+/// \brief Header of a block of records.
+struct BlockHeader
+{
+    uint32_t recordsCount;    ///< Records in the block.
+    uint32_t compressedSize;  ///< Size of the compressed records following the header.
+    uint32_t firstCycle;      ///< Cycle of the block's first record.
+    uint32_t reserved;        ///< Always 0.
+};
+
+/// \brief Compress the records of a block.
+///
+/// \param records the records to compress.
+/// \param count records count, at most eBlockRecords.
+/// \param[out] header receives the block's header.
+/// \param[out] output receives the compressed records.
+///
+/// \return the number of records in the block, less than count if the cycles jump.
+uint32_t encodeBlock(const Record* records,
+                     const uint32_t count,
+                     BlockHeader& header,
+                     std::vector<uint8_t>& output);
+
+/// \brief Decompress a block of records.
+///
+/// \param header the block's header.
+/// \param data the compressed records.
+/// \param[out] records receives the records.
+///
+/// \return true if the block is valid, false otherwise.
+bool decodeBlock(const BlockHeader& header, const uint8_t* data, std::vector<Record>& records);
+
+}  // namespace cputrace
+
+#endif /* CPUTRACE_H_ */
@@ -0,0 +1,157 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framedelta.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "framedelta.h"
+
+#include "hash.h"
+#include "utils.h"
+
+#include <algorithm>
+
+// =================================================================================================
+
+FrameDelta::FrameDelta(const uint16_t width, const uint16_t height) :
+    m_width(width), m_height(height), m_segmentsPerLine(width / eSegmentWidth),
+    m_hasPreviousFrame(false), m_hashes(m_segmentsPerLine * height),
+    m_dirtyLines((height + 63) / 64), m_dirtyLinesCount(0),
+    m_dirtyTiles(m_segmentsPerLine * ((height + eSegmentWidth - 1) / eSegmentWidth))
+{
+    CBASSERT((width % eSegmentWidth) == 0, "Frame width must be a multiple of 8");
+
+    m_dirtyRects.reserve(m_dirtyTiles.size());
+}
+
+// =================================================================================================
+
+uint64_t FrameDelta::hashSegment(const uint32_t* pixels)
+{
+    using namespace cbutil::xxh64;
+
+    // The 4 words go through the rounds of the XXH64 short input path, skipping the 4 lanes
+    // setup that only pays off on longer inputs.
+    const uint8_t* const bytes = reinterpret_cast<const uint8_t*>(pixels);
+
+    uint64_t hash = ePrime5 + 32;
+    for (uint8_t offset = 0; offset < 32; offset += 8)
+    {
+        hash ^= round(0, read64(bytes + offset));
+        hash = (rotateLeft(hash, 27) * ePrime1) + ePrime4;
+    }
+
+    return avalanche(hash);
+}
+
+// =================================================================================================
+
+void FrameDelta::update(const uint32_t* frame)
+{
+    std::fill(m_dirtyLines.begin(), m_dirtyLines.end(), 0);
+    std::fill(m_dirtyTiles.begin(), m_dirtyTiles.end(), 0);
+    m_dirtyLinesCount = 0;
+
+    for (uint16_t line = 0; line < m_height; ++line)
+    {
+        const uint32_t* const pixels = frame + (line * m_width);
+        uint64_t* const hashes = m_hashes.data() + (line * m_segmentsPerLine);
+        uint8_t* const dirtyTiles = m_dirtyTiles.data() +
+                                    ((line / eSegmentWidth) * m_segmentsPerLine);
+        bool lineDirty = false;
+
+        for (uint16_t segment = 0; segment < m_segmentsPerLine; ++segment)
+        {
+            const uint64_t hash = hashSegment(pixels + (segment * eSegmentWidth));
+            if ((m_hasPreviousFrame == false) || (hash != hashes[segment]))
+            {
+                hashes[segment] = hash;
+                dirtyTiles[segment] = 1;
+                lineDirty = true;
+            }
+        }
+
+        if (lineDirty == true)
+        {
+            m_dirtyLines[line / 64] |= uint64_t(1) << (line % 64);
+            ++m_dirtyLinesCount;
+        }
+    }
+
+    m_hasPreviousFrame = true;
+
+    buildDirtyRects(m_dirtyTiles);
+}
+
+// =================================================================================================
+
+void FrameDelta::buildDirtyRects(const std::vector<uint8_t>& dirtyTiles)
+{
+    m_dirtyRects.clear();
+
+    const uint16_t tileLines = static_cast<uint16_t>(dirtyTiles.size() / m_segmentsPerLine);
+    for (uint16_t tileLine = 0; tileLine < tileLines; ++tileLine)
+    {
+        const uint8_t* const tiles = dirtyTiles.data() + (tileLine * m_segmentsPerLine);
+        const uint16_t y = tileLine * eSegmentWidth;
+        const uint16_t height = std::min<uint16_t>(eSegmentWidth, m_height - y);
+
+        // One rectangle per run of changed tiles.
+        for (uint16_t col = 0; col < m_segmentsPerLine;)
+        {
+            if (tiles[col] == 0)
+            {
+                ++col;
+                continue;
+            }
+
+            const uint16_t firstCol = col;
+            while ((col < m_segmentsPerLine) && (tiles[col] != 0))
+            {
+                ++col;
+            }
+
+            const Rect rect = {static_cast<uint16_t>(firstCol * eSegmentWidth),
+                               y,
+                               static_cast<uint16_t>((col - firstCol) * eSegmentWidth),
+                               height};
+
+            // Extend the rectangle of the previous tiles line if it has the same columns.
+            const auto above = std::find_if(m_dirtyRects.begin(),
+                                            m_dirtyRects.end(),
+                                            [&rect](const Rect& other) {
+                                                return (other.x == rect.x) &&
+                                                       (other.width == rect.width) &&
+                                                       (other.y + other.height == rect.y);
+                                            });
+            if (above != m_dirtyRects.end())
+            {
+                above->height += rect.height;
+            }
+            else
+            {
+                m_dirtyRects.push_back(rect);
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framedelta.h
+///
+/// \brief     Detection of the regions of a frame that changed since the previous one.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef FRAMEDELTA_H_
+#define FRAMEDELTA_H_
+
+#include <cstdint>
+#include <vector>
+
+/// \brief Detection of the regions of a frame that changed since the previous one.
+///
+/// Each frame is cut in segments of 8 pixels of one line (a tile's row) that are hashed and
+/// compared with the hashes of the previous frame. No copy of the previous frame is kept.
+class FrameDelta
+{
+public:
+    /// \brief A rectangle of changed pixels.
+    struct Rect
+    {
+        uint16_t x;
+        uint16_t y;
+        uint16_t width;
+        uint16_t height;
+    };
+
+    /// \brief Constructor.
+    ///
+    /// \param width frames width in pixels, must be a multiple of 8.
+    /// \param height frames height in pixels.
+    FrameDelta(const uint16_t width, const uint16_t height);
+
+    /// \brief Compare a new frame with the previous one.
+    ///
+    /// \param frame the new frame.
+    void update(const uint32_t* frame);
+
+    /// \brief Forget the previous frame: the next one is entirely dirty.
+    void reset() { m_hasPreviousFrame = false; }
+
+    /// \brief Check if a line changed.
+    bool isLineDirty(const uint16_t line) const
+    {
+        return ((m_dirtyLines[line / 64] >> (line % 64)) & 0x1) != 0;
+    }
+
+    /// \brief Get the bitmap of the changed lines (bit n of word n / 64 for line n).
+    const std::vector<uint64_t>& getDirtyLines() const { return m_dirtyLines; }
+
+    /// \brief Get the number of changed lines.
+    uint16_t getDirtyLinesCount() const { return m_dirtyLinesCount; }
+
+    /// \brief Get the changed rectangles, at the granularity of 8x8 tiles.
+    const std::vector<Rect>& getDirtyRects() const { return m_dirtyRects; }
+
+    /// \brief Hash a segment of 8 pixels.
+    static uint64_t hashSegment(const uint32_t* pixels);
+
+private:
+    /// \brief Merge the changed segments into rectangles.
+    void buildDirtyRects(const std::vector<uint8_t>& dirtyTiles);
+
+    enum : uint8_t
+    {
+        eSegmentWidth = 8  ///< Pixels per hashed segment.
+    };
+
+    uint16_t m_width;                    ///< Frames width.
+    uint16_t m_height;                   ///< Frames height.
+    uint16_t m_segmentsPerLine;          ///< Hashed segments in a line.
+    bool m_hasPreviousFrame;             ///< Are the hashes of a previous frame available?
+    std::vector<uint64_t> m_hashes;      ///< Hashes of the previous frame's segments.
+    std::vector<uint64_t> m_dirtyLines;  ///< Changed lines bitmap.
+    uint16_t m_dirtyLinesCount;          ///< Number of changed lines.
+    std::vector<uint8_t> m_dirtyTiles;   ///< Changed tiles (8x8) of the last frame.
+    std::vector<Rect> m_dirtyRects;      ///< Changed rectangles.
+};
+
+#endif /* FRAMEDELTA_H_ */
@@ -0,0 +1,176 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      frameexporter.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "frameexporter.h"
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+FrameExporter::~FrameExporter()
+{
+    close();
+}
+
+// =================================================================================================
+
+bool FrameExporter::open(const std::string& segmentName,
+                         const uint32_t width,
+                         const uint32_t height,
+                         const uint32_t dirtyLineHeight)
+{
+    close();
+
+    const int fd = shm_open(segmentName.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const uint32_t stride = width * sizeof(uint32_t);
+    const uint32_t slotSize = stride * height;
+    // Keep the pixels page aligned.
+    const size_t slotsOffset = (sizeof(sharedframe::SegmentHeader) + 4095) & ~size_t(4095);
+    const size_t segmentSize = slotsOffset + (sharedframe::eSlotsCount * size_t(slotSize));
+
+    void* mem = MAP_FAILED;
+    if (ftruncate(fd, segmentSize) == 0)
+    {
+        mem = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if (mem == MAP_FAILED)
+    {
+        shm_unlink(segmentName.c_str());
+        return false;
+    }
+
+    m_header = new (mem) sharedframe::SegmentHeader();
+    m_header->width = width;
+    m_header->height = height;
+    m_header->stride = stride;
+    m_header->pixelFormat = static_cast<uint32_t>(getPixelFormat());
+    m_header->slotsCount = sharedframe::eSlotsCount;
+    m_header->slotSize = slotSize;
+    m_header->slotsOffset = slotsOffset;
+    m_header->dirtyLineHeight = dirtyLineHeight;
+    m_header->generation.store(0, std::memory_order_relaxed);
+    m_header->latestSlot.store(0, std::memory_order_relaxed);
+    for (sharedframe::SlotHeader& slot : m_header->slots)
+    {
+        slot.sequence.store(0, std::memory_order_relaxed);
+        slot.flags = 0;
+        slot.frameNumber = 0;
+    }
+    m_header->version = sharedframe::eVersion;
+
+    // The magic is written last so that readers never see a half initialized header.
+    std::atomic_thread_fence(std::memory_order_release);
+    m_header->magic = sharedframe::eMagic;
+
+    m_segmentName = segmentName;
+    m_segmentSize = segmentSize;
+    m_writeSlot = 0;
+    m_frameNumber = 0;
+    m_frameAcquired = false;
+
+    return true;
+}
+
+// =================================================================================================
+
+void FrameExporter::close()
+{
+    if (m_header == nullptr)
+    {
+        return;
+    }
+
+    munmap(m_header, m_segmentSize);
+    shm_unlink(m_segmentName.c_str());
+
+    m_header = nullptr;
+    m_segmentSize = 0;
+    m_segmentName.clear();
+}
+
+// =================================================================================================
+
+uint32_t* FrameExporter::acquireFrame()
+{
+    CBASSERT(isOpen() == true, "Frame exporter used before being opened");
+
+    // The sinks chain was rebuilt while a frame was being rendered: keep rendering in its slot.
+    if (m_frameAcquired == true)
+    {
+        return reinterpret_cast<uint32_t*>(
+            const_cast<uint8_t*>(sharedframe::getSlotPixels(m_header, m_writeSlot)));
+    }
+    m_frameAcquired = true;
+
+    // Never render over the newest complete frame: take the oldest of the two other slots.
+    m_writeSlot = (m_header->latestSlot.load(std::memory_order_relaxed) + 1) %
+                  sharedframe::eSlotsCount;
+
+    sharedframe::SlotHeader& slot = m_header->slots[m_writeSlot];
+    // Odd sequence: the slot is being written.
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return reinterpret_cast<uint32_t*>(
+        const_cast<uint8_t*>(sharedframe::getSlotPixels(m_header, m_writeSlot)));
+}
+
+// =================================================================================================
+
+void FrameExporter::publishFrame()
+{
+    sharedframe::SlotHeader& slot = m_header->slots[m_writeSlot];
+    slot.frameNumber = m_frameNumber++;
+    m_frameAcquired = false;
+
+    slot.flags = 0;
+    if ((m_frameDelta != nullptr) &&
+        (m_frameDelta->getDirtyLines().size() <= (sharedframe::eMaxDirtyLines / 64)))
+    {
+        const std::vector<uint64_t>& dirtyLines = m_frameDelta->getDirtyLines();
+        std::fill(std::begin(slot.dirtyLines), std::end(slot.dirtyLines), 0);
+        std::copy(dirtyLines.begin(), dirtyLines.end(), std::begin(slot.dirtyLines));
+        slot.flags |= sharedframe::eSLOTFLAG_dirtylines;
+    }
+
+    // Even sequence: the slot holds a complete frame.
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_release);
+    m_header->latestSlot.store(m_writeSlot, std::memory_order_release);
+    m_header->generation.fetch_add(1, std::memory_order_release);
+}
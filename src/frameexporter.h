@@ -0,0 +1,96 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      frameexporter.h
+///
+/// \brief     Publishes the completed frames into a POSIX shared memory triple buffer.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef FRAMEEXPORTER_H_
+#define FRAMEEXPORTER_H_
+
+#include "framesink.h"
+#include "framedelta.h"
+#include "sharedframe.h"
+#include "types.h"
+
+#include <string>
+
+/// \brief Publishes the PPU frames into a shared memory segment readable by other processes.
+///
+/// The PPU renders straight into one of the three slots of the segment, the readers access the
+/// newest complete frame in place. Neither side ever waits for the other.
+/// \see sharedframe.h for the segment's layout and the reading protocol.
+class FrameExporter : public FrameSink
+{
+public:
+    FrameExporter() = default;
+    ~FrameExporter();
+
+    FrameExporter(const FrameExporter&) = delete;
+    FrameExporter& operator=(const FrameExporter&) = delete;
+
+    /// \brief Create and map the shared memory segment.
+    ///
+    /// \param segmentName POSIX shared memory object name, must start with a '/'.
+    /// \param width frames width in pixels.
+    /// \param height frames height in pixels.
+    /// \param dirtyLineHeight frame lines covered by one line of the frame delta.
+    ///
+    /// \return true if the segment is ready, false otherwise.
+    bool open(const std::string& segmentName,
+              const uint32_t width,
+              const uint32_t height,
+              const uint32_t dirtyLineHeight = 1);
+
+    /// \brief Unmap and remove the shared memory segment.
+    void close();
+
+    /// \brief Check if the shared memory segment is ready.
+    bool isOpen() const { return m_header != nullptr; }
+
+    /// \brief Get the shared memory object name.
+    const std::string& getSegmentName() const { return m_segmentName; }
+
+    /// \brief Get the layout of the exported pixels.
+    PixelFormat getPixelFormat() const { return PixelFormat::ePIXFMT_rgba8888; }
+
+    /// \brief Publish the changed lines along with each frame.
+    ///
+    /// \param frameDelta changes of the frame being published, nullptr to mark the whole frames
+    ///                   as changed.
+    void setFrameDelta(const FrameDelta* frameDelta) { m_frameDelta = frameDelta; }
+
+    uint32_t* acquireFrame() override;
+    void publishFrame() override;
+
+private:
+    std::string m_segmentName;                       ///< Shared memory object name.
+    sharedframe::SegmentHeader* m_header = nullptr;  ///< Start of the mapped segment.
+    size_t m_segmentSize = 0;                        ///< Mapped size in bytes.
+    uint32_t m_writeSlot = 0;                        ///< Slot being rendered.
+    uint64_t m_frameNumber = 0;                      ///< Number of the frame being rendered.
+    bool m_frameAcquired = false;                    ///< Is a slot being rendered?
+    const FrameDelta* m_frameDelta = nullptr;        ///< Changes of the frame being rendered.
+};
+
+#endif /* FRAMEEXPORTER_H_ */
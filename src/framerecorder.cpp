@@ -0,0 +1,223 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framerecorder.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "framerecorder.h"
+
+#include "hash.h"
+
+#include <chrono>
+#include <cstring>
+
+FrameRecorder::FrameRecorder(const uint16_t width, const uint16_t height) :
+    m_width(width), m_height(height), m_format(RecordFormat::eRECFORMAT_y4m), m_output(nullptr),
+    m_frame(nullptr), m_ownFrame(width * height), m_droppedFrames(0), m_file(nullptr, &fclose),
+    m_queueSize(0), m_queueHead(0), m_queueTail(0), m_stop(false)
+{
+}
+
+// =================================================================================================
+
+FrameRecorder::~FrameRecorder()
+{
+    close();
+}
+
+// =================================================================================================
+
+bool FrameRecorder::open(const std::filesystem::path& path,
+                         const RecordFormat format,
+                         const uint32_t queueSize)
+{
+    close();
+
+    m_file.reset(std::fopen(path.string().c_str(), "wb"));
+    if (m_file == nullptr)
+    {
+        return false;
+    }
+
+    const size_t framePixels = m_width * m_height;
+
+    m_format = format;
+    m_queueSize = queueSize;
+    m_queueHead = 0;
+    m_queueTail = 0;
+    m_droppedFrames = 0;
+
+    if (m_format == RecordFormat::eRECFORMAT_y4m)
+    {
+        m_queueFrames.resize(framePixels * queueSize);
+        m_conversion.resize(framePixels * 3);
+
+        // 4:4:4 keeps the pixel art sharp. One frame lasts 70224 clocks of the 4194304 Hz clock.
+        std::fprintf(m_file.get(), "YUV4MPEG2 W%u H%u F4194304:70224 Ip A1:1 C444\n", m_width,
+                     m_height);
+    }
+    else
+    {
+        m_queueHashes.resize(queueSize);
+    }
+
+    m_stop = false;
+    m_writer = std::thread(&FrameRecorder::writerLoop, this);
+
+    return true;
+}
+
+// =================================================================================================
+
+void FrameRecorder::close()
+{
+    if (m_file == nullptr)
+    {
+        return;
+    }
+
+    m_stop = true;
+    m_wakeUp.notify_one();
+    m_writer.join();
+
+    m_file.reset();
+    m_queueFrames.clear();
+    m_queueFrames.shrink_to_fit();
+    m_queueHashes.clear();
+    m_conversion.clear();
+}
+
+// =================================================================================================
+
+uint32_t* FrameRecorder::acquireFrame()
+{
+    m_frame = (m_output != nullptr) ? m_output->acquireFrame() : m_ownFrame.data();
+
+    return m_frame;
+}
+
+// =================================================================================================
+
+void FrameRecorder::publishFrame()
+{
+    if (isOpen() == true)
+    {
+        const size_t framePixels = m_width * m_height;
+        const uint64_t head = m_queueHead.load(std::memory_order_relaxed);
+
+        // Never wait for the writer: a frame that does not fit is lost.
+        if ((head - m_queueTail.load(std::memory_order_acquire)) >= m_queueSize)
+        {
+            ++m_droppedFrames;
+        }
+        else
+        {
+            const uint32_t entry = head % m_queueSize;
+            if (m_format == RecordFormat::eRECFORMAT_y4m)
+            {
+                std::memcpy(m_queueFrames.data() + (entry * framePixels),
+                            m_frame,
+                            framePixels * sizeof(uint32_t));
+            }
+            else
+            {
+                m_queueHashes[entry] = cbutil::hashXXH64(m_frame, framePixels * sizeof(uint32_t));
+            }
+
+            m_queueHead.store(head + 1, std::memory_order_release);
+            m_wakeUp.notify_one();
+        }
+    }
+
+    if (m_output != nullptr)
+    {
+        m_output->publishFrame();
+    }
+}
+
+// =================================================================================================
+
+void FrameRecorder::writerLoop()
+{
+    while (true)
+    {
+        // Read the stop request first: the entries pushed before it are then all visible.
+        const bool stop = m_stop.load(std::memory_order_acquire);
+        const uint64_t tail = m_queueTail.load(std::memory_order_relaxed);
+
+        if (tail == m_queueHead.load(std::memory_order_acquire))
+        {
+            if (stop == true)
+            {
+                break;
+            }
+
+            // The producer notifies without locking, the timeout covers a missed notification.
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUp.wait_for(lock, std::chrono::milliseconds(10), [this, tail]() {
+                return (m_stop == true) || (m_queueHead.load(std::memory_order_acquire) != tail);
+            });
+
+            continue;
+        }
+
+        writeEntry(tail % m_queueSize);
+        m_queueTail.store(tail + 1, std::memory_order_release);
+    }
+
+    std::fflush(m_file.get());
+}
+
+// =================================================================================================
+
+void FrameRecorder::writeEntry(const uint32_t entry)
+{
+    if (m_format == RecordFormat::eRECFORMAT_hashlog)
+    {
+        std::fprintf(m_file.get(), "%016llx\n",
+                     static_cast<unsigned long long>(m_queueHashes[entry]));
+        return;
+    }
+
+    // BT.601 limited range RGB to YUV conversion.
+    const size_t framePixels = m_width * m_height;
+    const uint8_t* rgba =
+        reinterpret_cast<const uint8_t*>(m_queueFrames.data() + (entry * framePixels));
+    uint8_t* y = m_conversion.data();
+    uint8_t* u = y + framePixels;
+    uint8_t* v = u + framePixels;
+
+    for (size_t idx = 0; idx < framePixels; ++idx, rgba += 4)
+    {
+        const int32_t r = rgba[0];
+        const int32_t g = rgba[1];
+        const int32_t b = rgba[2];
+
+        y[idx] = static_cast<uint8_t>((((66 * r) + (129 * g) + (25 * b) + 128) >> 8) + 16);
+        u[idx] = static_cast<uint8_t>((((-38 * r) - (74 * g) + (112 * b) + 128) >> 8) + 128);
+        v[idx] = static_cast<uint8_t>((((112 * r) - (94 * g) - (18 * b) + 128) >> 8) + 128);
+    }
+
+    std::fputs("FRAME\n", m_file.get());
+    std::fwrite(m_conversion.data(), 1, m_conversion.size(), m_file.get());
+}
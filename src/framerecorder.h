@@ -0,0 +1,125 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framerecorder.h
+///
+/// \brief     Recording of the completed frames to a file on a background thread.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef FRAMERECORDER_H_
+#define FRAMERECORDER_H_
+
+#include "framesink.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Content of a recording.
+enum class RecordFormat : uint8_t
+{
+    eRECFORMAT_y4m,     ///< Raw YUV 4:4:4 video stream (YUV4MPEG2).
+    eRECFORMAT_hashlog  ///< One XXH64 hash of the RGBA pixels per frame, as a hexadecimal line.
+};
+
+/// \brief Records the frames going through it, then forwards them to its output sink.
+///
+/// The emulation thread only copies each frame (or its hash) into a bounded queue, the file is
+/// converted and written by a background thread. When the queue is full the frame is dropped
+/// and counted instead of waiting for the disk.
+class FrameRecorder : public FrameSink
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param width frames width in pixels.
+    /// \param height frames height in pixels.
+    FrameRecorder(const uint16_t width, const uint16_t height);
+    ~FrameRecorder();
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    /// \brief Create the recording file and start the writer thread.
+    ///
+    /// \param path recording file path.
+    /// \param format content of the recording.
+    /// \param queueSize frames the queue holds before dropping.
+    ///
+    /// \return true if the recording started, false otherwise.
+    bool open(const std::filesystem::path& path,
+              const RecordFormat format,
+              const uint32_t queueSize = 128);
+
+    /// \brief Write the queued frames, stop the writer thread and close the file.
+    void close();
+
+    /// \brief Check if a recording is in progress.
+    bool isOpen() const { return m_file != nullptr; }
+
+    /// \brief Set the sink receiving the frames once recorded, nullptr if none.
+    void setOutput(FrameSink* output) { m_output = output; }
+
+    /// \brief Get the number of frames dropped because the queue was full.
+    uint64_t getDroppedFramesCount() const { return m_droppedFrames; }
+
+    uint32_t* acquireFrame() override;
+    void publishFrame() override;
+
+private:
+    /// \brief Main loop of the writer thread.
+    void writerLoop();
+
+    /// \brief Write one queued frame to the file.
+    void writeEntry(const uint32_t entry);
+
+    uint16_t m_width;                  ///< Frames width.
+    uint16_t m_height;                 ///< Frames height.
+    RecordFormat m_format;             ///< Content of the recording.
+    FrameSink* m_output;               ///< Receives the recorded frames.
+    uint32_t* m_frame;                 ///< Frame being rendered.
+    std::vector<uint32_t> m_ownFrame;  ///< Frame buffer used when there is no output.
+    uint64_t m_droppedFrames;          ///< Frames that did not fit in the queue.
+
+    std::unique_ptr<FILE, decltype(&fclose)> m_file;  ///< Recording file.
+    std::vector<uint8_t> m_conversion;                ///< Y4M planes of the frame being written.
+
+    // Single producer (emulation thread), single consumer (writer thread) queue.
+    uint32_t m_queueSize;                 ///< Number of entries in the queue.
+    std::vector<uint32_t> m_queueFrames;  ///< Pixels of the queued frames (Y4M only).
+    std::vector<uint64_t> m_queueHashes;  ///< Hashes of the queued frames (hash log only).
+    std::atomic<uint64_t> m_queueHead;    ///< Entries pushed by the emulation thread.
+    std::atomic<uint64_t> m_queueTail;    ///< Entries written by the writer thread.
+
+    std::thread m_writer;              ///< Writer thread.
+    std::mutex m_mutex;                ///< Protects the writer's sleep.
+    std::condition_variable m_wakeUp;  ///< Signals new entries to the writer.
+    std::atomic<bool> m_stop;          ///< Is the writer asked to exit?
+};
+
+#endif /* FRAMERECORDER_H_ */
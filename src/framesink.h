@@ -0,0 +1,49 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      framesink.h
+///
+/// \brief     Destination of the frames rendered by the PPU.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef FRAMESINK_H_
+#define FRAMESINK_H_
+
+#include <cstdint>
+
+/// \brief Destination of the frames rendered by the PPU.
+///
+/// The PPU renders each frame directly into the buffer handed out by acquireFrame(), so a sink
+/// can expose its own memory (e.g. a shared memory segment) without any intermediate copy.
+class FrameSink
+{
+public:
+    /// \brief Get the buffer where the next frame will be rendered.
+    ///
+    /// \return pointer to a buffer large enough for one frame of the sink's resolution.
+    virtual uint32_t* acquireFrame() = 0;
+
+    /// \brief Notify the sink that the last acquired frame is complete.
+    virtual void publishFrame() = 0;
+};
+
+#endif /* FRAMESINK_H_ */
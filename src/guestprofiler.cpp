@@ -0,0 +1,211 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      guestprofiler.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "guestprofiler.h"
+#include "hash.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+GuestProfiler::GuestProfiler(BankResolver bankResolver) : m_bankResolver(std::move(bankResolver))
+{
+    m_contexts.reserve(eMaxContexts);
+    m_contextsIndex.resize(eContextsSlots);
+    m_samples.resize(eMaxSamples);
+
+    reset();
+}
+
+// =================================================================================================
+
+void GuestProfiler::enterRoutine(const uint16_t address, const uint16_t stackPointer)
+{
+    // Deeper calls are ignored, their returns don't match any frame either.
+    if (m_depth == eMaxDepth)
+    {
+        return;
+    }
+
+    const uint16_t caller = (m_depth == 0) ? eRootContext : m_callStack[m_depth - 1].context;
+    m_callStack[m_depth] = {getContext(caller, m_bankResolver(address), address), stackPointer};
+    ++m_depth;
+}
+
+// =================================================================================================
+
+void GuestProfiler::leaveRoutine(const uint16_t stackPointer)
+{
+    // A RET pops its frame's return address: SP goes above the frame's SP. The frames whose
+    // return address was dropped by the game are left along with it, and a RET used as an
+    // indirect jump (PUSH then RET) is above no frame.
+    while ((m_depth > 0) && (m_callStack[m_depth - 1].stackPointer < stackPointer))
+    {
+        --m_depth;
+    }
+}
+
+// =================================================================================================
+
+void GuestProfiler::sample(const uint16_t pc)
+{
+    ++m_samplesCount;
+
+    const uint16_t context = (m_depth == 0) ? eRootContext : m_callStack[m_depth - 1].context;
+    const uint64_t key = (static_cast<uint64_t>(context) << 32) |
+                         (static_cast<uint64_t>(m_bankResolver(pc)) << 16) | pc;
+
+    // Open addressing with linear probing.
+    size_t slot = cbutil::xxh64::avalanche(key) % eMaxSamples;
+    for (uint32_t probe = 0; probe < eMaxSamples; ++probe)
+    {
+        Sample& sample = m_samples[slot];
+        if (sample.count == 0)
+        {
+            sample.key = key;
+            sample.count = 1;
+            return;
+        }
+        if (sample.key == key)
+        {
+            ++sample.count;
+            return;
+        }
+
+        slot = (slot + 1) % eMaxSamples;
+    }
+
+    ++m_droppedSamplesCount;
+}
+
+// =================================================================================================
+
+bool GuestProfiler::writeFoldedStacks(const std::filesystem::path& path) const
+{
+    std::unique_ptr<FILE, decltype(&fclose)> file(std::fopen(path.string().c_str(), "w"),
+                                                  &fclose);
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<uint16_t> contexts;
+    std::string line;
+    for (const Sample& sample : m_samples)
+    {
+        if (sample.count == 0)
+        {
+            continue;
+        }
+
+        contexts.clear();
+        for (uint16_t context = sample.key >> 32; context != eRootContext;
+             context = m_contexts[context].parent)
+        {
+            contexts.push_back(context);
+        }
+
+        // From the outermost routine to the sampled instruction.
+        line.clear();
+        for (auto context = contexts.rbegin(); context != contexts.rend(); ++context)
+        {
+            line += getFrameName(m_contexts[*context].bank, m_contexts[*context].address);
+            line += ';';
+        }
+        line += getFrameName((sample.key >> 16) & 0xFFFF, sample.key & 0xFFFF);
+
+        std::fprintf(file.get(), "%s %" PRIu64 "\n", line.c_str(), sample.count);
+    }
+
+    return std::ferror(file.get()) == 0;
+}
+
+// =================================================================================================
+
+void GuestProfiler::reset()
+{
+    m_contexts.assign(1, {eRootContext, eNoBank, 0});
+    std::fill(m_contextsIndex.begin(), m_contextsIndex.end(), eEmptySlot);
+    std::fill(m_samples.begin(), m_samples.end(), Sample());
+
+    m_depth = 0;
+    m_samplesCount = 0;
+    m_droppedSamplesCount = 0;
+}
+
+// =================================================================================================
+
+uint16_t GuestProfiler::getContext(const uint16_t parent,
+                                   const uint16_t bank,
+                                   const uint16_t address)
+{
+    const uint64_t key = (static_cast<uint64_t>(parent) << 32) |
+                         (static_cast<uint64_t>(bank) << 16) | address;
+
+    size_t slot = cbutil::xxh64::avalanche(key) % eContextsSlots;
+    while (m_contextsIndex[slot] != eEmptySlot)
+    {
+        const Context& context = m_contexts[m_contextsIndex[slot]];
+        if ((context.parent == parent) && (context.bank == bank) && (context.address == address))
+        {
+            return m_contextsIndex[slot];
+        }
+
+        slot = (slot + 1) % eContextsSlots;
+    }
+
+    // The index has twice as many slots as contexts: there is always a free one.
+    if (m_contexts.size() == eMaxContexts)
+    {
+        return parent;
+    }
+
+    m_contextsIndex[slot] = static_cast<uint16_t>(m_contexts.size());
+    m_contexts.push_back({parent, bank, address});
+
+    return m_contextsIndex[slot];
+}
+
+// =================================================================================================
+
+std::string GuestProfiler::getFrameName(const uint16_t bank, const uint16_t address)
+{
+    char name[16];
+    if (bank == eNoBank)
+    {
+        std::snprintf(name, sizeof(name), "RAM:%04X", address);
+    }
+    else if (bank == eBootROMBank)
+    {
+        std::snprintf(name, sizeof(name), "BOOT:%04X", address);
+    }
+    else
+    {
+        std::snprintf(name, sizeof(name), "ROM%02X:%04X", bank, address);
+    }
+
+    return name;
+}
@@ -0,0 +1,141 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      guestprofiler.h
+///
+/// \brief     Sampling profiler of the code run by the emulated games.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef GUESTPROFILER_H_
+#define GUESTPROFILER_H_
+
+#include "calltracer.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// \brief Sampling profiler of the code run by the emulated games.
+///
+/// Each sample counts the (ROM bank, PC) of the running instruction under the routines the CPU
+/// called to get there. The call stacks form a tree of calling contexts, and the samples are
+/// counted per (context, bank, PC). Both live in fixed size hash tables allocated once: when a
+/// table is full, the new contexts are merged with their caller and the new samples are dropped.
+class GuestProfiler : public CallTracer
+{
+public:
+    enum : uint16_t
+    {
+        eNoBank = 0xFFFF,       ///< Bank of the code running from RAM.
+        eBootROMBank = 0xFFFE,  ///< Bank of the boot ROM.
+        eMaxDepth = 256,        ///< Deepest call stack tracked.
+        eMaxContexts = 8192,    ///< Calling contexts capacity.
+        eMaxSamples = 32768     ///< Distinct samples capacity.
+    };
+
+    /// \brief Get the bank of the code at an address.
+    using BankResolver = std::function<uint16_t(const uint16_t address)>;
+
+    /// \brief Constructor.
+    ///
+    /// \param bankResolver gives the bank mapped at an address, eNoBank outside of the ROM.
+    explicit GuestProfiler(BankResolver bankResolver);
+
+    void enterRoutine(const uint16_t address, const uint16_t stackPointer) override;
+    void leaveRoutine(const uint16_t stackPointer) override;
+
+    /// \brief Count a sample of the running code.
+    ///
+    /// \param pc address of the running instruction.
+    void sample(const uint16_t pc);
+
+    /// \brief Write the samples as folded stacks, the input of the flame graph tools.
+    ///
+    /// Each line holds the routines from the outermost to the sampled PC, separated by ';', then
+    /// the samples count. Each frame is the bank and the address, e.g. "ROM01:4A20".
+    ///
+    /// \return true if the file was written, false otherwise.
+    bool writeFoldedStacks(const std::filesystem::path& path) const;
+
+    /// \brief Forget the samples and the call stack.
+    void reset();
+
+    /// \brief Get the number of samples taken.
+    uint64_t getSamplesCount() const { return m_samplesCount; }
+
+    /// \brief Get the number of samples dropped because their table was full.
+    uint64_t getDroppedSamplesCount() const { return m_droppedSamplesCount; }
+
+private:
+    enum : uint16_t
+    {
+        eRootContext = 0,                   ///< Context of the code outside of any routine.
+        eContextsSlots = eMaxContexts * 2,  ///< Slots of the contexts' hash index.
+        eEmptySlot = 0xFFFF                 ///< Free slot of the contexts' hash index.
+    };
+
+    /// \brief A routine called from a calling context.
+    struct Context
+    {
+        uint16_t parent;   ///< Caller's context.
+        uint16_t bank;     ///< Routine's bank.
+        uint16_t address;  ///< Routine's address.
+    };
+
+    /// \brief A routine of the current call stack.
+    struct Frame
+    {
+        uint16_t context;       ///< Routine's calling context.
+        uint16_t stackPointer;  ///< SP once the return address was pushed.
+    };
+
+    /// \brief Count of a (context, bank, PC).
+    struct Sample
+    {
+        uint64_t key = 0;    ///< Context, bank and PC.
+        uint64_t count = 0;  ///< Samples count, 0 for a free slot.
+    };
+
+    /// \brief Find the context of a routine called from a context, or add it.
+    ///
+    /// \return the routine's context, the caller's one if the contexts table is full.
+    uint16_t getContext(const uint16_t parent, const uint16_t bank, const uint16_t address);
+
+    /// \brief Get the name of a frame: bank and address.
+    static std::string getFrameName(const uint16_t bank, const uint16_t address);
+
+    BankResolver m_bankResolver;  ///< Gives the bank mapped at an address.
+
+    std::vector<Context> m_contexts;        ///< Calling contexts tree.
+    std::vector<uint16_t> m_contextsIndex;  ///< Hash index of the contexts.
+    std::vector<Sample> m_samples;          ///< Samples hash table.
+
+    std::array<Frame, eMaxDepth> m_callStack;  ///< Routines of the current call stack.
+    uint16_t m_depth = 0;                      ///< Routines count in the call stack.
+
+    uint64_t m_samplesCount = 0;         ///< Samples taken.
+    uint64_t m_droppedSamplesCount = 0;  ///< Samples dropped because their table was full.
+};
+
+#endif /* GUESTPROFILER_H_ */
@@ -0,0 +1,157 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      hash.h
+///
+/// \brief     XXH64 hashing of frames and memory blocks.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef HASH_H_
+#define HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cbutil
+{
+namespace xxh64
+{
+constexpr uint64_t ePrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t ePrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t ePrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t ePrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t ePrime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotateLeft(const uint64_t value, const uint8_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t round(uint64_t acc, const uint64_t input)
+{
+    acc += input * ePrime2;
+    acc = rotateLeft(acc, 31);
+    return acc * ePrime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, const uint64_t value)
+{
+    acc ^= round(0, value);
+    return (acc * ePrime1) + ePrime4;
+}
+
+inline uint64_t avalanche(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= ePrime2;
+    hash ^= hash >> 29;
+    hash *= ePrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+inline uint64_t read64(const uint8_t* data)
+{
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+}  // namespace xxh64
+
+/// \brief Hash a memory block with XXH64 (little endian hosts).
+///
+/// \param data start of the block.
+/// \param size size of the block in bytes.
+/// \param seed hash seed.
+///
+/// \return the XXH64 hash of the block.
+inline uint64_t hashXXH64(const void* data, const size_t size, const uint64_t seed = 0)
+{
+    using namespace xxh64;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = bytes + size;
+    uint64_t hash;
+
+    if (size >= 32)
+    {
+        uint64_t acc1 = seed + ePrime1 + ePrime2;
+        uint64_t acc2 = seed + ePrime2;
+        uint64_t acc3 = seed;
+        uint64_t acc4 = seed - ePrime1;
+
+        for (; bytes + 32 <= end; bytes += 32)
+        {
+            acc1 = round(acc1, read64(bytes));
+            acc2 = round(acc2, read64(bytes + 8));
+            acc3 = round(acc3, read64(bytes + 16));
+            acc4 = round(acc4, read64(bytes + 24));
+        }
+
+        hash = rotateLeft(acc1, 1) + rotateLeft(acc2, 7) + rotateLeft(acc3, 12) +
+               rotateLeft(acc4, 18);
+        hash = mergeRound(hash, acc1);
+        hash = mergeRound(hash, acc2);
+        hash = mergeRound(hash, acc3);
+        hash = mergeRound(hash, acc4);
+    }
+    else
+    {
+        hash = seed + ePrime5;
+    }
+
+    hash += size;
+
+    for (; bytes + 8 <= end; bytes += 8)
+    {
+        hash ^= round(0, read64(bytes));
+        hash = (rotateLeft(hash, 27) * ePrime1) + ePrime4;
+    }
+
+    if (bytes + 4 <= end)
+    {
+        hash ^= static_cast<uint64_t>(read32(bytes)) * ePrime1;
+        hash = (rotateLeft(hash, 23) * ePrime2) + ePrime3;
+        bytes += 4;
+    }
+
+    for (; bytes < end; ++bytes)
+    {
+        hash ^= (*bytes) * ePrime5;
+        hash = rotateLeft(hash, 11) * ePrime1;
+    }
+
+    return avalanche(hash);
+}
+
+}  // namespace cbutil
+
+#endif /* HASH_H_ */
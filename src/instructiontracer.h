@@ -0,0 +1,45 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      instructiontracer.h
+///
+/// \brief     Observer of the instructions run by the CPU.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef INSTRUCTIONTRACER_H_
+#define INSTRUCTIONTRACER_H_
+
+#include "cputrace.h"
+
+/// \brief Observer of the instructions run by the CPU.
+///
+/// The CPU reports each instruction when it is fetched, before it runs. The prefix CB
+/// instructions are reported once, with their 0xCB prefix as opcode.
+class InstructionTracer
+{
+public:
+    /// \brief An instruction was fetched.
+    ///
+    /// \param record the instruction and the registers before it runs.
+    virtual void traceInstruction(const cputrace::Record& record) = 0;
+};
+
+#endif /* INSTRUCTIONTRACER_H_ */
@@ -0,0 +1,97 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      joypad.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "joypad.h"
+
+Joypad::Joypad(Mmu& mmu) : m_mmu(mmu), m_buttons(0), m_select(0x30)
+{
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_p1,
+        [this]() -> uint8_t { return 0xC0 | m_select | getLines(); },
+        [this](const uint8_t byte) {
+            const uint8_t previousLines = getLines();
+            m_select = byte & 0x30;
+            checkInterrupt(previousLines);
+        });
+}
+
+// =================================================================================================
+
+void Joypad::setButtons(const uint8_t buttons)
+{
+    const uint8_t previousLines = getLines();
+    m_buttons = buttons;
+    checkInterrupt(previousLines);
+}
+
+// =================================================================================================
+
+void Joypad::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_joypad, eStateVersion);
+
+    writer.write(m_buttons);
+    writer.write(m_select);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Joypad::loadState(StateReader& reader)
+{
+    return (reader.openSection(savestate::eSECTION_joypad) == true) &&
+           reader.read(m_buttons) && reader.read(m_select);
+}
+
+// =================================================================================================
+
+uint8_t Joypad::getLines() const
+{
+    uint8_t pressed = 0;
+    if ((m_select & 0x10) == 0)
+    {
+        pressed |= m_buttons & 0x0F;
+    }
+    if ((m_select & 0x20) == 0)
+    {
+        pressed |= m_buttons >> 4;
+    }
+
+    return ~pressed & 0x0F;
+}
+
+// =================================================================================================
+
+void Joypad::checkInterrupt(const uint8_t previousLines)
+{
+    if ((previousLines & ~getLines()) != 0)
+    {
+        m_mmu.writeByte(m_mmu.readByte(HardwareIORegisters::eIOREG_if) |
+                            InterruptFlags::eINTFLAG_joypad,
+                        HardwareIORegisters::eIOREG_if);
+    }
+}
@@ -0,0 +1,97 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      joypad.h
+///
+/// \brief     Emulation of the joypad register.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef JOYPAD_H_
+#define JOYPAD_H_
+
+#include "mmu.h"
+#include "savestate.h"
+
+#include <cstdint>
+
+/// \brief Buttons of the joypad, as a bit mask.
+enum JoypadButtons : uint8_t
+{
+    eBUTTON_right = 0x01,   ///< Direction right.
+    eBUTTON_left = 0x02,    ///< Direction left.
+    eBUTTON_up = 0x04,      ///< Direction up.
+    eBUTTON_down = 0x08,    ///< Direction down.
+    eBUTTON_a = 0x10,       ///< Button A.
+    eBUTTON_b = 0x20,       ///< Button B.
+    eBUTTON_select = 0x40,  ///< Button Select.
+    eBUTTON_start = 0x80    ///< Button Start.
+};
+
+/// \brief Emulation of the joypad register (P1) and of the joypad interrupt.
+///
+/// The game selects the directions and/or the buttons with bits 4-5 of P1 and reads the
+/// selected keys in bits 0-3, a pressed key reading as 0.
+class Joypad
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param mmu memory management unit routing the P1 register to the joypad.
+    explicit Joypad(Mmu& mmu);
+
+    Joypad(const Joypad&) = delete;
+    Joypad& operator=(const Joypad&) = delete;
+
+    /// \brief Set the pressed buttons.
+    ///
+    /// \param buttons JoypadButtons mask of the pressed buttons.
+    void setButtons(const uint8_t buttons);
+
+    /// \brief Get the pressed buttons.
+    uint8_t getButtons() const { return m_buttons; }
+
+    /// \brief Write the joypad state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the joypad state.
+    ///
+    /// \return true if the state holds the joypad section, false otherwise.
+    bool loadState(StateReader& reader);
+
+private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    /// \brief Get the P1 input lines (bits 0-3, 0 when a selected key is pressed).
+    uint8_t getLines() const;
+
+    /// \brief Request the joypad interrupt if an input line went from 1 to 0.
+    void checkInterrupt(const uint8_t previousLines);
+
+    Mmu& m_mmu;         ///< Memory management unit, holds the IF register.
+    uint8_t m_buttons;  ///< Pressed buttons.
+    uint8_t m_select;   ///< P1 bits 4-5, a 0 bit selects the directions or the buttons.
+};
+
+#endif /* JOYPAD_H_ */
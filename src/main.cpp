@@ -25,16 +25,33 @@
 
 // Local includes.
 #include "console.h"
+#include "opcodeprofile.h"
 
 int main(int argc, char* argv[])
 {
     std::string cartPath;
-    if (argc > 1)
+    std::filesystem::path recordPath;
+    BootMode bootMode = BootMode::eBOOTMODE_bootROM;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
     {
-        cartPath = argv[1];
+        const std::string arg = argv[argIdx];
+        // --record FILE: a .y4m file receives the video, any other file a log of frame hashes.
+        if ((arg == "--record") && (argIdx + 1 < argc))
+        {
+            recordPath = argv[++argIdx];
+        }
+        // --fast-start: skip the boot ROM.
+        else if (arg == "--fast-start")
+        {
+            bootMode = BootMode::eBOOTMODE_fastStart;
+        }
+        else
+        {
+            cartPath = arg;
+        }
     }
     // #ifdef COLORBOY_DEBUG
-    else
+    if (cartPath.empty() == true)
     {
         cartPath = "/home/dartzon/Dev-Workspace/ColorBoy/gb-test-roms/cpu_instrs/cpu_instrs.gb";
     }
@@ -42,7 +59,26 @@ int main(int argc, char* argv[])
 
     Console gameboy(GBType::eGBTYPE_dmg, cartPath);
 
-    gameboy.powerOn();
+    if (recordPath.empty() == false)
+    {
+        const RecordFormat format = (recordPath.extension() == ".y4m") ?
+                                        RecordFormat::eRECFORMAT_y4m :
+                                        RecordFormat::eRECFORMAT_hashlog;
+        if (gameboy.recordFrames(recordPath, format) == false)
+        {
+            printf("Cannot create the recording file '%s'\n", recordPath.string().c_str());
+            return 1;
+        }
+    }
+
+    gameboy.powerOn(bootMode);
+    while (gameboy.runFrame() == true)
+    {
+    }
+
+#ifdef COLORBOY_OPCODE_PROFILE
+    OpcodeProfile::dump(stdout);
+#endif
 
     return 0;
 }
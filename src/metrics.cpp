@@ -0,0 +1,118 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      metrics.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "metrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+uint64_t LatencyHistogram::getPercentile(const double percentile) const
+{
+    std::array<uint64_t, eBucketsCount> counts;
+    uint64_t total = 0;
+    for (uint32_t index = 0; index < eBucketsCount; ++index)
+    {
+        counts[index] = m_buckets[index].load(std::memory_order_relaxed);
+        total += counts[index];
+    }
+
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(total * std::clamp(percentile, 0.0, 100.0) / 100.0)));
+    uint64_t count = 0;
+    for (uint32_t index = 0; index < eBucketsCount; ++index)
+    {
+        count += counts[index];
+        if (count >= rank)
+        {
+            return getBucketUpperBound(index);
+        }
+    }
+
+    return getBucketUpperBound(eBucketsCount - 1);
+}
+
+// =================================================================================================
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value)
+{
+    // The small values have a bucket each.
+    if (value < eSubBuckets)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    value = std::min(value, (uint64_t(1) << eMaxBits) - 1);
+
+    uint32_t highestBit = 63;
+    while ((value >> highestBit) == 0)
+    {
+        --highestBit;
+    }
+
+    // The eSubBucketsBits bits below the highest one select the linear bucket.
+    const uint32_t shift = highestBit - eSubBucketsBits;
+    const uint32_t subBucket = static_cast<uint32_t>(value >> shift) - eSubBuckets;
+
+    return ((shift + 1) * eSubBuckets) + subBucket;
+}
+
+// =================================================================================================
+
+uint64_t LatencyHistogram::getBucketUpperBound(const uint32_t index)
+{
+    if (index < eSubBuckets)
+    {
+        return index;
+    }
+
+    const uint32_t shift = (index / eSubBuckets) - 1;
+    const uint64_t lowerBound = static_cast<uint64_t>(eSubBuckets + (index % eSubBuckets)) << shift;
+
+    return lowerBound + (uint64_t(1) << shift) - 1;
+}
+
+// =================================================================================================
+
+MetricsSnapshot ConsoleMetrics::getSnapshot() const
+{
+    MetricsSnapshot snapshot;
+    snapshot.emulatedClocks = emulatedClocks.load(std::memory_order_relaxed);
+    snapshot.frames = frames.load(std::memory_order_relaxed);
+    snapshot.instructions = instructions.load(std::memory_order_relaxed);
+    snapshot.interrupts = interrupts.load(std::memory_order_relaxed);
+    snapshot.bankSwitches = bankSwitches.load(std::memory_order_relaxed);
+    snapshot.haltedClocks = haltedClocks.load(std::memory_order_relaxed);
+    snapshot.hostNs = hostNs.load(std::memory_order_relaxed);
+    snapshot.hostCPUNs = hostCPUNs.load(std::memory_order_relaxed);
+    snapshot.frameTimeP50Ns = frameTimeNs.getPercentile(50.0);
+    snapshot.frameTimeP99Ns = frameTimeNs.getPercentile(99.0);
+
+    return snapshot;
+}
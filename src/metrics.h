@@ -0,0 +1,109 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      metrics.h
+///
+/// \brief     Live health numbers of a console, readable from any thread.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/// \brief Histogram of durations with a bounded relative error, in the HDR histograms way.
+///
+/// The values are split in power of two ranges, each divided into eSubBuckets linear buckets:
+/// a percentile is within 1 / eSubBuckets of the real value. One thread records, any thread reads.
+class LatencyHistogram
+{
+public:
+    enum : uint32_t
+    {
+        eSubBucketsBits = 4,                 ///< Sub buckets per power of two, as bits.
+        eSubBuckets = 1 << eSubBucketsBits,  ///< Linear buckets per power of two.
+        eMaxBits = 40,                       ///< Larger values are clamped (~18 minutes).
+        eBucketsCount = (eMaxBits - eSubBucketsBits + 1) * eSubBuckets  ///< Total buckets.
+    };
+
+    /// \brief Count a value.
+    void record(const uint64_t value)
+    {
+        std::atomic<uint64_t>& bucket = m_buckets[getBucketIndex(value)];
+        // A single writer: no read-modify-write needed.
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /// \brief Get a percentile of the counted values.
+    ///
+    /// \param percentile from 0 to 100.
+    ///
+    /// \return the upper bound of the bucket holding the percentile, 0 if nothing was counted.
+    uint64_t getPercentile(const double percentile) const;
+
+private:
+    /// \brief Get the bucket of a value.
+    static uint32_t getBucketIndex(uint64_t value);
+
+    /// \brief Get the largest value of a bucket.
+    static uint64_t getBucketUpperBound(const uint32_t index);
+
+    std::array<std::atomic<uint64_t>, eBucketsCount> m_buckets{};  ///< Values count per bucket.
+};
+
+/// \brief Plain copy of the metrics of a console.
+struct MetricsSnapshot
+{
+    uint64_t emulatedClocks = 0;  ///< Master clocks emulated, the run-ahead ones included.
+    uint64_t frames = 0;          ///< Frames run.
+    uint64_t instructions = 0;    ///< CPU instructions executed, the run-ahead ones included.
+    uint64_t interrupts = 0;      ///< Interrupts dispatched by the CPU.
+    uint64_t bankSwitches = 0;    ///< VRAM and WRAM bank switches requested by the game.
+    uint64_t haltedClocks = 0;    ///< Master clocks spent with the CPU stopped.
+    uint64_t hostNs = 0;          ///< Wall time spent running frames.
+    uint64_t hostCPUNs = 0;       ///< CPU time of the host spent running frames.
+    uint64_t frameTimeP50Ns = 0;  ///< Median wall time of a frame.
+    uint64_t frameTimeP99Ns = 0;  ///< 99th percentile of the wall time of a frame.
+};
+
+/// \brief Live health numbers of a console.
+///
+/// The console publishes them once per frame with relaxed stores, any thread can read them
+/// without ever blocking the emulation.
+struct ConsoleMetrics
+{
+    std::atomic<uint64_t> emulatedClocks{0};  ///< Master clocks emulated, run-ahead included.
+    std::atomic<uint64_t> frames{0};          ///< Frames run.
+    std::atomic<uint64_t> instructions{0};    ///< CPU instructions executed.
+    std::atomic<uint64_t> interrupts{0};      ///< Interrupts dispatched by the CPU.
+    std::atomic<uint64_t> bankSwitches{0};    ///< VRAM and WRAM bank switches.
+    std::atomic<uint64_t> haltedClocks{0};    ///< Master clocks spent with the CPU stopped.
+    std::atomic<uint64_t> hostNs{0};          ///< Wall time spent running frames.
+    std::atomic<uint64_t> hostCPUNs{0};       ///< Host CPU time spent running frames.
+    LatencyHistogram frameTimeNs;             ///< Wall time of each frame.
+
+    /// \brief Read all the metrics.
+    MetricsSnapshot getSnapshot() const;
+};
+
+#endif /* METRICS_H_ */
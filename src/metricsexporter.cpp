@@ -0,0 +1,342 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      metricsexporter.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "metricsexporter.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+/// \brief A metric of the Prometheus file.
+struct PrometheusMetric
+{
+    const char* name;                                    ///< Metric's name.
+    const char* type;                                    ///< "counter" or "gauge".
+    const char* help;                                    ///< Metric's description.
+    double (*getValue)(const MetricsSnapshot&, double);  ///< Value from a snapshot and the MHz.
+};
+
+const PrometheusMetric prometheusMetrics[] = {
+    {"colorboy_emulated_clocks_total", "counter", "Master clocks emulated.",
+     [](const MetricsSnapshot& snapshot, double) {
+         return static_cast<double>(snapshot.emulatedClocks);
+     }},
+    {"colorboy_frames_total", "counter", "Frames run.",
+     [](const MetricsSnapshot& snapshot, double) { return static_cast<double>(snapshot.frames); }},
+    {"colorboy_instructions_total", "counter", "CPU instructions executed.",
+     [](const MetricsSnapshot& snapshot, double) {
+         return static_cast<double>(snapshot.instructions);
+     }},
+    {"colorboy_interrupts_total", "counter", "Interrupts dispatched by the CPU.",
+     [](const MetricsSnapshot& snapshot, double) {
+         return static_cast<double>(snapshot.interrupts);
+     }},
+    {"colorboy_bank_switches_total", "counter", "VRAM and WRAM bank switches.",
+     [](const MetricsSnapshot& snapshot, double) {
+         return static_cast<double>(snapshot.bankSwitches);
+     }},
+    {"colorboy_halted_ratio", "gauge", "Share of the emulated clocks with the CPU stopped.",
+     [](const MetricsSnapshot& snapshot, double) {
+         return (snapshot.emulatedClocks > 0) ?
+                    static_cast<double>(snapshot.haltedClocks) / snapshot.emulatedClocks :
+                    0.0;
+     }},
+    {"colorboy_emulated_mhz", "gauge", "Emulation speed since the previous export.",
+     [](const MetricsSnapshot&, double emulatedMHz) { return emulatedMHz; }},
+    {"colorboy_host_seconds_total", "counter", "Wall time spent running frames.",
+     [](const MetricsSnapshot& snapshot, double) { return snapshot.hostNs * 1e-9; }},
+    {"colorboy_host_cpu_seconds_total", "counter", "Host CPU time spent running frames.",
+     [](const MetricsSnapshot& snapshot, double) { return snapshot.hostCPUNs * 1e-9; }}};
+
+}  // namespace
+
+// =================================================================================================
+
+MetricsExporter::~MetricsExporter()
+{
+    stop();
+}
+
+// =================================================================================================
+
+bool MetricsExporter::start(const std::filesystem::path& path,
+                            const MetricsFormat format,
+                            const std::chrono::milliseconds period)
+{
+    stop();
+
+    m_path = path;
+    m_format = format;
+    m_period = period;
+
+    if (m_format == MetricsFormat::eMETRICSFORMAT_mmap)
+    {
+        const int fd = ::open(m_path.string().c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        void* mapping = MAP_FAILED;
+        if (ftruncate(fd, sizeof(sharedmetrics::FileHeader)) == 0)
+        {
+            mapping = mmap(nullptr,
+                           sizeof(sharedmetrics::FileHeader),
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED,
+                           fd,
+                           0);
+        }
+        ::close(fd);
+
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        // The file is zero filled: every block is inactive with an even sequence.
+        m_mapped = new (mapping) sharedmetrics::FileHeader;
+        m_mapped->magic = sharedmetrics::eMagic;
+        m_mapped->version = sharedmetrics::eVersion;
+        m_mapped->maxConsoles = sharedmetrics::eMaxConsoles;
+        m_mapped->blockSize = sizeof(sharedmetrics::ConsoleBlock);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = false;
+        exportMetrics();
+    }
+
+    m_thread = std::thread(&MetricsExporter::exportLoop, this);
+
+    return true;
+}
+
+// =================================================================================================
+
+void MetricsExporter::stop()
+{
+    if (m_thread.joinable() == false)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+    m_thread.join();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        exportMetrics();
+    }
+    unmap();
+}
+
+// =================================================================================================
+
+void MetricsExporter::addConsole(const std::string& name, const ConsoleMetrics& metrics)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sources.push_back({name,
+                         &metrics,
+                         metrics.emulatedClocks.load(std::memory_order_relaxed),
+                         std::chrono::steady_clock::now()});
+}
+
+// =================================================================================================
+
+void MetricsExporter::removeConsole(const ConsoleMetrics& metrics)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sources.erase(std::remove_if(m_sources.begin(),
+                                   m_sources.end(),
+                                   [&metrics](const Source& source) {
+                                       return source.metrics == &metrics;
+                                   }),
+                    m_sources.end());
+}
+
+// =================================================================================================
+
+void MetricsExporter::exportLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_wakeUp.wait_for(lock, m_period, [this]() { return m_stop; }) == false)
+    {
+        exportMetrics();
+    }
+}
+
+// =================================================================================================
+
+void MetricsExporter::exportMetrics()
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    std::vector<MetricsSnapshot> snapshots;
+    std::vector<double> emulatedMHz;
+    snapshots.reserve(m_sources.size());
+    emulatedMHz.reserve(m_sources.size());
+    for (Source& source : m_sources)
+    {
+        snapshots.push_back(source.metrics->getSnapshot());
+
+        const double elapsedUs =
+            std::chrono::duration<double, std::micro>(now - source.lastTime).count();
+        const uint64_t clocks = snapshots.back().emulatedClocks;
+        emulatedMHz.push_back((elapsedUs > 0.0) ? (clocks - source.lastClocks) / elapsedUs : 0.0);
+
+        source.lastClocks = clocks;
+        source.lastTime = now;
+    }
+
+    if (m_format == MetricsFormat::eMETRICSFORMAT_prometheus)
+    {
+        writePrometheus(snapshots, emulatedMHz);
+    }
+    else if (m_mapped != nullptr)
+    {
+        writeMapped(snapshots, emulatedMHz);
+    }
+}
+
+// =================================================================================================
+
+void MetricsExporter::writePrometheus(const std::vector<MetricsSnapshot>& snapshots,
+                                      const std::vector<double>& emulatedMHz)
+{
+    // Written aside then renamed: a scraper never reads a partial file.
+    std::filesystem::path tmpPath = m_path;
+    tmpPath += ".tmp";
+
+    std::unique_ptr<FILE, decltype(&fclose)> file(std::fopen(tmpPath.string().c_str(), "w"),
+                                                  &fclose);
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    for (const PrometheusMetric& metric : prometheusMetrics)
+    {
+        std::fprintf(file.get(), "# HELP %s %s\n", metric.name, metric.help);
+        std::fprintf(file.get(), "# TYPE %s %s\n", metric.name, metric.type);
+        for (size_t idx = 0; idx < snapshots.size(); ++idx)
+        {
+            std::fprintf(file.get(),
+                         "%s{console=\"%s\"} %.17g\n",
+                         metric.name,
+                         m_sources[idx].name.c_str(),
+                         metric.getValue(snapshots[idx], emulatedMHz[idx]));
+        }
+    }
+
+    std::fprintf(file.get(), "# HELP colorboy_frame_time_seconds Wall time of a frame.\n");
+    std::fprintf(file.get(), "# TYPE colorboy_frame_time_seconds summary\n");
+    for (size_t idx = 0; idx < snapshots.size(); ++idx)
+    {
+        const char* name = m_sources[idx].name.c_str();
+        std::fprintf(file.get(),
+                     "colorboy_frame_time_seconds{console=\"%s\",quantile=\"0.5\"} %.9f\n"
+                     "colorboy_frame_time_seconds{console=\"%s\",quantile=\"0.99\"} %.9f\n"
+                     "colorboy_frame_time_seconds_sum{console=\"%s\"} %.9f\n"
+                     "colorboy_frame_time_seconds_count{console=\"%s\"} %" PRIu64 "\n",
+                     name,
+                     snapshots[idx].frameTimeP50Ns * 1e-9,
+                     name,
+                     snapshots[idx].frameTimeP99Ns * 1e-9,
+                     name,
+                     snapshots[idx].hostNs * 1e-9,
+                     name,
+                     snapshots[idx].frames);
+    }
+
+    if (std::ferror(file.get()) == 0)
+    {
+        file.reset();
+        std::error_code error;
+        std::filesystem::rename(tmpPath, m_path, error);
+    }
+}
+
+// =================================================================================================
+
+void MetricsExporter::writeMapped(const std::vector<MetricsSnapshot>& snapshots,
+                                  const std::vector<double>& emulatedMHz)
+{
+    for (uint32_t idx = 0; idx < sharedmetrics::eMaxConsoles; ++idx)
+    {
+        sharedmetrics::ConsoleBlock& block = m_mapped->consoles[idx];
+
+        block.sequence.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        block.active = (idx < snapshots.size()) ? 1 : 0;
+        if (block.active == 1)
+        {
+            const MetricsSnapshot& snapshot = snapshots[idx];
+            std::strncpy(block.name, m_sources[idx].name.c_str(), sharedmetrics::eNameSize - 1);
+            block.name[sharedmetrics::eNameSize - 1] = '\0';
+            block.emulatedClocks = snapshot.emulatedClocks;
+            block.frames = snapshot.frames;
+            block.instructions = snapshot.instructions;
+            block.interrupts = snapshot.interrupts;
+            block.bankSwitches = snapshot.bankSwitches;
+            block.haltedClocks = snapshot.haltedClocks;
+            block.hostNs = snapshot.hostNs;
+            block.hostCPUNs = snapshot.hostCPUNs;
+            block.frameTimeP50Ns = snapshot.frameTimeP50Ns;
+            block.frameTimeP99Ns = snapshot.frameTimeP99Ns;
+            block.emulatedMHz = emulatedMHz[idx];
+        }
+
+        block.sequence.fetch_add(1, std::memory_order_release);
+    }
+
+    m_mapped->exportsCount.fetch_add(1, std::memory_order_release);
+}
+
+// =================================================================================================
+
+void MetricsExporter::unmap()
+{
+    if (m_mapped != nullptr)
+    {
+        munmap(m_mapped, sizeof(sharedmetrics::FileHeader));
+        m_mapped = nullptr;
+    }
+}
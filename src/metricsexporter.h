@@ -0,0 +1,125 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      metricsexporter.h
+///
+/// \brief     Periodic export of the consoles' metrics to a file.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef METRICSEXPORTER_H_
+#define METRICSEXPORTER_H_
+
+#include "metrics.h"
+#include "sharedmetrics.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// \brief Content of the metrics file.
+enum class MetricsFormat : uint8_t
+{
+    eMETRICSFORMAT_prometheus,  ///< Prometheus text exposition format, for a node exporter.
+    eMETRICSFORMAT_mmap         ///< Memory mapped sharedmetrics::FileHeader.
+};
+
+/// \brief Writes the metrics of the registered consoles to a file from its own thread.
+///
+/// The consoles are only read through their lock-free ConsoleMetrics, the emulation threads
+/// never wait for the exporter.
+class MetricsExporter
+{
+public:
+    MetricsExporter() = default;
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    /// \brief Start exporting periodically.
+    ///
+    /// \param path metrics file path. The Prometheus file is replaced atomically on each export.
+    /// \param format content of the file.
+    /// \param period time between two exports.
+    ///
+    /// \return true if the exports started, false if the file cannot be created.
+    bool start(const std::filesystem::path& path,
+               const MetricsFormat format,
+               const std::chrono::milliseconds period);
+
+    /// \brief Export a last time and stop.
+    void stop();
+
+    /// \brief Export the metrics of a console.
+    ///
+    /// \param name console's name in the exported file, unique among the consoles.
+    /// \param metrics console's metrics, registered until removeConsole().
+    ///
+    /// The memory mapped file only holds the first sharedmetrics::eMaxConsoles consoles.
+    void addConsole(const std::string& name, const ConsoleMetrics& metrics);
+
+    /// \brief Stop exporting the metrics of a console, before it is destroyed.
+    void removeConsole(const ConsoleMetrics& metrics);
+
+private:
+    /// \brief A registered console.
+    struct Source
+    {
+        std::string name;                                ///< Name in the exported file.
+        const ConsoleMetrics* metrics;                   ///< Console's metrics.
+        uint64_t lastClocks;                             ///< Emulated clocks at the last export.
+        std::chrono::steady_clock::time_point lastTime;  ///< Time of the last export.
+    };
+
+    /// \brief Main loop of the export thread.
+    void exportLoop();
+
+    /// \brief Read the consoles' metrics and write them, m_mutex must be locked.
+    void exportMetrics();
+
+    /// \brief Write the Prometheus text file.
+    void writePrometheus(const std::vector<MetricsSnapshot>& snapshots,
+                         const std::vector<double>& emulatedMHz);
+
+    /// \brief Update the memory mapped file.
+    void writeMapped(const std::vector<MetricsSnapshot>& snapshots,
+                     const std::vector<double>& emulatedMHz);
+
+    /// \brief Unmap the memory mapped file.
+    void unmap();
+
+    std::filesystem::path m_path;                                       ///< Metrics file path.
+    MetricsFormat m_format = MetricsFormat::eMETRICSFORMAT_prometheus;  ///< Content of the file.
+    std::chrono::milliseconds m_period{1000};                           ///< Time between exports.
+    sharedmetrics::FileHeader* m_mapped = nullptr;                      ///< Memory mapped file.
+
+    std::mutex m_mutex;                ///< Protects the sources and the stop flag.
+    std::condition_variable m_wakeUp;  ///< Wakes the export thread up to stop.
+    bool m_stop = false;               ///< Is the export thread asked to stop?
+    std::vector<Source> m_sources;     ///< Registered consoles.
+    std::thread m_thread;              ///< Export thread.
+};
+
+#endif /* METRICSEXPORTER_H_ */
@@ -30,13 +30,56 @@
 
 #include <array>
 #include <algorithm>
+#include <functional>
 
 #include "config.h"
 
+/// \brief Pages of 256 bytes written through an Mmu, listed in the order of their first write.
+///
+/// Lets a caller undo the writes of a run in O(written pages), e.g. between two fuzzing runs.
+class WrittenPages
+{
+public:
+    /// \brief Mark the page of an address as written.
+    void mark(const uint16_t address)
+    {
+        const uint8_t page = address >> 8;
+        if (m_marked[page] == false)
+        {
+            m_marked[page] = true;
+            m_pages[m_count++] = page;
+        }
+    }
+
+    /// \brief Forget the written pages.
+    void clear()
+    {
+        for (size_t idx = 0; idx < m_count; ++idx)
+        {
+            m_marked[m_pages[idx]] = false;
+        }
+        m_count = 0;
+    }
+
+    /// \brief Get the number of written pages.
+    size_t size() const { return m_count; }
+
+    /// \brief Get the number of a written page, its first address divided by 256.
+    uint8_t operator[](const size_t idx) const { return m_pages[idx]; }
+
+private:
+    std::array<bool, 256> m_marked = {};   ///< Is the page written?
+    std::array<uint8_t, 256> m_pages = {};  ///< Written pages, in the order of their first write.
+    size_t m_count = 0;                     ///< Number of written pages.
+};
+
 /// \brief Representation of a Memory management unit.
 class Mmu
 {
 public:
+    /// \brief Constructor, the memory is unmapped until the console maps its buffers.
+    Mmu() { unmapMemory(0, m_memoryMap.size()); }
+
     /// \brief Read byte from memory address.
     ///
     /// \param address Memory address to read from.
@@ -47,6 +90,16 @@ public:
         CBASSERT((address >= 0) && (address <= m_memoryMap.size() - 1),
                  "Out of bounds memory read");
 
+        if (isIORegister(address) == true)
+        {
+            const IOReadHandler& handler =
+                m_ioReadHandlers[address - MemoryAreas::eMEMADDR_ioregsstart];
+            if (handler)
+            {
+                return handler();
+            }
+        }
+
         return *m_memoryMap[address];
     }
 
@@ -72,6 +125,27 @@ public:
         CBASSERT((address >= 0) && (address <= m_memoryMap.size() - 1),
                  "Out of bounds memory write");
 
+        if ((address < m_readOnlyEnd) || (m_memoryMap[address] == &m_openBus))
+        {
+            return;
+        }
+
+        if (m_writtenPages != nullptr)
+        {
+            m_writtenPages->mark(address);
+        }
+
+        if (isIORegister(address) == true)
+        {
+            const IOWriteHandler& handler =
+                m_ioWriteHandlers[address - MemoryAreas::eMEMADDR_ioregsstart];
+            if (handler)
+            {
+                handler(byte);
+                return;
+            }
+        }
+
         *m_memoryMap[address] = byte;
     }
 
@@ -84,10 +158,38 @@ public:
         CBASSERT((address >= 0) && (address <= m_memoryMap.size() - 1),
                  "Out of bounds memory write");
 
-        *m_memoryMap[address] = word & 0xFF;
-        *m_memoryMap[address + 1] = word >> 8;
+        writeByte(word & 0xFF, address);
+        writeByte(word >> 8, address + 1);
     }
 
+    using IOReadHandler = std::function<uint8_t()>;
+    using IOWriteHandler = std::function<void(const uint8_t)>;
+
+    /// \brief Route the accesses to an I/O register to the component emulating it.
+    ///
+    /// \param address I/O register address (0xFF00 - 0xFF7F).
+    /// \param readHandler called instead of reading the memory, may be empty.
+    /// \param writeHandler called instead of writing the memory, may be empty.
+    void setIOHandlers(const uint16_t address,
+                       IOReadHandler readHandler,
+                       IOWriteHandler writeHandler)
+    {
+        CBASSERT(isIORegister(address) == true, "Not an I/O register");
+
+        m_ioReadHandlers[address - MemoryAreas::eMEMADDR_ioregsstart] = std::move(readHandler);
+        m_ioWriteHandlers[address - MemoryAreas::eMEMADDR_ioregsstart] = std::move(writeHandler);
+    }
+
+    /// \brief Mark the pages written from now on.
+    ///
+    /// \param writtenPages receives the written pages, nullptr to stop marking them.
+    void setWrittenPages(WrittenPages* writtenPages) { m_writtenPages = writtenPages; }
+
+    /// \brief Drop the writes below an address, the buffers mapped there are shared.
+    ///
+    /// \param end first writable address, 0 to make the whole memory writable.
+    void setReadOnlyEnd(const uint16_t end) { m_readOnlyEnd = end; }
+
     /// \brief Map data from a buffer to the internal RAM.
     ///
     /// \param buffer buffer to map.
@@ -111,8 +213,33 @@ public:
         }
     }
 
+    /// \brief Point addresses at the open bus, where nothing is mapped: they read 0xFF and
+    /// drop the writes.
+    ///
+    /// \param startAddr first unmapped address.
+    /// \param endAddr address following the last unmapped one.
+    void unmapMemory(const size_t startAddr, const size_t endAddr)
+    {
+        std::fill(m_memoryMap.begin() + startAddr, m_memoryMap.begin() + endAddr, &m_openBus);
+    }
+
 private:
+    /// \brief Check if an address belongs to the I/O registers area.
+    static bool isIORegister(const uint16_t address)
+    {
+        return (address >= MemoryAreas::eMEMADDR_ioregsstart) &&
+               (address < MemoryAreas::eMEMADDR_zeropagestart);
+    }
+
     std::array<uint8_t*, GBConfig::memorySize> m_memoryMap;
+
+    ///< Handlers of the emulated I/O registers.
+    std::array<IOReadHandler, MemoryAreasSizes::eMEMSIZE_ioregs> m_ioReadHandlers;
+    std::array<IOWriteHandler, MemoryAreasSizes::eMEMSIZE_ioregs> m_ioWriteHandlers;
+
+    WrittenPages* m_writtenPages = nullptr;  ///< Receives the written pages, if any.
+    uint16_t m_readOnlyEnd = 0;              ///< First writable address.
+    uint8_t m_openBus = 0xFF;                ///< Read at the unmapped addresses.
 };
 
 #endif /* MMU_H_ */
@@ -0,0 +1,153 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      movie.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "movie.h"
+
+#include <cstdio>
+#include <memory>
+
+namespace
+{
+/// \brief Movie file's header.
+struct MovieHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    GBType type;
+    uint8_t reserved0;
+    uint64_t romHash;
+    uint32_t stateSize;
+    uint32_t inputsCount;
+    uint32_t framesCount;
+    uint32_t reserved1;
+};
+
+static_assert(sizeof(MovieHeader) == 32, "Unexpected movie header layout");
+
+}  // namespace
+
+// =================================================================================================
+
+void Movie::start(const GBType type,
+                  const uint64_t romHash,
+                  const uint8_t* state,
+                  const size_t stateSize)
+{
+    m_type = type;
+    m_romHash = romHash;
+    m_startState.assign(state, state + stateSize);
+    m_inputs.clear();
+    m_frames.clear();
+}
+
+// =================================================================================================
+
+bool Movie::save(const std::filesystem::path& path) const
+{
+    std::unique_ptr<FILE, decltype(&fclose)> file(std::fopen(path.string().c_str(), "wb"),
+                                                  &fclose);
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    const MovieHeader header = {eMagic,
+                                eVersion,
+                                m_type,
+                                0,
+                                m_romHash,
+                                static_cast<uint32_t>(m_startState.size()),
+                                static_cast<uint32_t>(m_inputs.size()),
+                                static_cast<uint32_t>(m_frames.size()),
+                                0};
+
+    bool written = (std::fwrite(&header, sizeof(header), 1, file.get()) == 1) &&
+                   (std::fwrite(m_startState.data(), 1, m_startState.size(), file.get()) ==
+                    m_startState.size());
+
+    for (const InputEvent& input : m_inputs)
+    {
+        written = written && (std::fwrite(&input.clock, sizeof(input.clock), 1, file.get()) == 1) &&
+                  (std::fwrite(&input.buttons, sizeof(input.buttons), 1, file.get()) == 1);
+    }
+
+    written = written && (std::fwrite(m_frames.data(), sizeof(uint64_t), m_frames.size(),
+                                      file.get()) == m_frames.size());
+
+    return written;
+}
+
+// =================================================================================================
+
+bool Movie::load(const std::filesystem::path& path)
+{
+    std::unique_ptr<FILE, decltype(&fclose)> file(std::fopen(path.string().c_str(), "rb"),
+                                                  &fclose);
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    MovieHeader header;
+    if ((std::fread(&header, sizeof(header), 1, file.get()) != 1) || (header.magic != eMagic) ||
+        (header.version != eVersion))
+    {
+        return false;
+    }
+
+    // The sizes come from the file: they must describe exactly what it holds before anything is
+    // allocated.
+    std::error_code error;
+    const uintmax_t fileSize = std::filesystem::file_size(path, error);
+    const uint64_t inputSize = sizeof(InputEvent::clock) + sizeof(InputEvent::buttons);
+    const uint64_t expectedSize = sizeof(header) + uint64_t{header.stateSize} +
+                                  (inputSize * header.inputsCount) +
+                                  (sizeof(uint64_t) * header.framesCount);
+    if ((error) || (fileSize != expectedSize))
+    {
+        return false;
+    }
+
+    m_type = header.type;
+    m_romHash = header.romHash;
+
+    m_startState.resize(header.stateSize);
+    bool read = (std::fread(m_startState.data(), 1, m_startState.size(), file.get()) ==
+                 m_startState.size());
+
+    m_inputs.resize(header.inputsCount);
+    for (InputEvent& input : m_inputs)
+    {
+        read = read && (std::fread(&input.clock, sizeof(input.clock), 1, file.get()) == 1) &&
+               (std::fread(&input.buttons, sizeof(input.buttons), 1, file.get()) == 1);
+    }
+
+    m_frames.resize(header.framesCount);
+    read = read && (std::fread(m_frames.data(), sizeof(uint64_t), m_frames.size(), file.get()) ==
+                    m_frames.size());
+
+    return read;
+}
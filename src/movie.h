@@ -0,0 +1,114 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      movie.h
+///
+/// \brief     Recorded inputs of a session, replayed bit-exact.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef MOVIE_H_
+#define MOVIE_H_
+
+#include "config.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+// =================================================================================================
+//   Movie file:
+//
+// Header    magic "CBMV" (4) | version (2) | GB type (1) | 0 (1) | ROM hash (8)
+//           start state size (4) | inputs count (4) | frames count (4) | 0 (4)
+// State     state of the console when the recording started
+// Inputs    master clock (8) | pressed buttons (1), for each change of the joypad
+// Frames    state hash (8), for each frame
+//
+// Every value is stored in the host's byte order, like the save states.
+// =================================================================================================
+
+/// \brief The joypad inputs of a session against the master clock, and the hash of the state at
+///        the end of every frame to check that a replay is bit-exact.
+///
+/// The console is deterministic: starting from the same state and receiving the same inputs at
+/// the same clocks, it goes through the same states.
+class Movie
+{
+public:
+    /// \brief Change of the pressed buttons.
+    struct InputEvent
+    {
+        uint64_t clock;   ///< Master clock of the change.
+        uint8_t buttons;  ///< JoypadButtons mask of the pressed buttons.
+    };
+
+    /// \brief Start a new movie.
+    ///
+    /// \param type emulated Game Boy's type.
+    /// \param romHash hash of the cartridge's ROM.
+    /// \param state state of the console when the recording starts.
+    /// \param stateSize size of the state.
+    void start(const GBType type,
+               const uint64_t romHash,
+               const uint8_t* state,
+               const size_t stateSize);
+
+    /// \brief Record a change of the pressed buttons.
+    void addInput(const uint64_t clock, const uint8_t buttons)
+    {
+        m_inputs.push_back({clock, buttons});
+    }
+
+    /// \brief Record the hash of the state at the end of a frame.
+    void addFrame(const uint64_t stateHash) { m_frames.push_back(stateHash); }
+
+    /// \brief Write the movie into a file.
+    ///
+    /// \return true if the file was written, false otherwise.
+    bool save(const std::filesystem::path& path) const;
+
+    /// \brief Read a movie file.
+    ///
+    /// \return true if the file is a valid movie, false otherwise.
+    bool load(const std::filesystem::path& path);
+
+    GBType getType() const { return m_type; }
+    uint64_t getROMHash() const { return m_romHash; }
+    const std::vector<uint8_t>& getStartState() const { return m_startState; }
+    const std::vector<InputEvent>& getInputs() const { return m_inputs; }
+    const std::vector<uint64_t>& getFrames() const { return m_frames; }
+
+private:
+    enum : uint32_t
+    {
+        eMagic = 0x564D4243,  ///< "CBMV".
+        eVersion = 1          ///< Format version.
+    };
+
+    GBType m_type = GBType::eGBTYPE_dmg;  ///< Emulated Game Boy's type.
+    uint64_t m_romHash = 0;               ///< Hash of the cartridge's ROM.
+    std::vector<uint8_t> m_startState;    ///< State of the console at the start.
+    std::vector<InputEvent> m_inputs;     ///< Changes of the pressed buttons.
+    std::vector<uint64_t> m_frames;       ///< State hash at the end of every frame.
+};
+
+#endif /* MOVIE_H_ */
@@ -0,0 +1,80 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      opcodeprofile.h
+///
+/// \brief     Execution counters of the CPU opcodes.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OPCODEPROFILE_H_
+#define OPCODEPROFILE_H_
+
+// The profile is only built with -DCOLORBOY_OPCODE_PROFILE=ON, the CPU has no counters otherwise.
+#ifdef COLORBOY_OPCODE_PROFILE
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+
+/// \brief Counts the executions and the cycles of the 256 base and 256 prefix CB opcodes.
+///
+/// Each thread counts in its own non-atomic counters, which are merged by dump(). The counters
+/// of a thread are merged into the totals when the thread exits.
+class OpcodeProfile
+{
+public:
+    enum : uint16_t
+    {
+        eOpcodesCount = 0x200,  ///< Base opcodes followed by the prefix CB opcodes.
+        eMaxCycles = 8          ///< Last bin of the cycles histogram, longer instructions included.
+    };
+
+    /// \brief Count an executed instruction in the calling thread's counters.
+    ///
+    /// \param prefixCB true for a prefix CB opcode.
+    /// \param opcode the instruction's opcode.
+    /// \param cycles CPU cycles taken by the instruction, from its fetch to its execution.
+    static void record(const bool prefixCB, const uint8_t opcode, const uint32_t cycles);
+
+    /// \brief Print the merged counters of all threads, the most executed opcodes first.
+    ///
+    /// The counters of the threads still running are read as they are: dump once the consoles
+    /// are paused or done for exact numbers.
+    static void dump(std::FILE* file);
+
+    /// \brief Clear the counters of all threads.
+    static void reset();
+
+    /// \brief Counters of one thread.
+    struct Counters
+    {
+        std::array<uint64_t, eOpcodesCount> executions{};  ///< Executions of each opcode.
+        std::array<uint64_t, eOpcodesCount> cycles{};      ///< CPU cycles of each opcode.
+        std::array<uint64_t, eMaxCycles + 1> histogram{};  ///< Instructions by CPU cycles.
+
+        /// \brief Add the counts of other counters to these ones.
+        void merge(const Counters& other);
+    };
+};
+
+#endif  // COLORBOY_OPCODE_PROFILE
+
+#endif /* OPCODEPROFILE_H_ */
@@ -27,31 +27,25 @@
 #include "ppu.h"
 
 #include <thread>
+#include <algorithm>
 
 void Ppu::cycle(const uint32_t currentCPUCycle)
 {
-    printf(">>> Line %u\tCPU Cycle %u\t",
+#ifdef COLORBOY_DEBUG
+    static const char* const modesNames[] = {
+        "H-Blank", "V-Blank", "Scanline OAM", "Scanline LCD transfer"};
+    printf(">>> Line %u\tCPU Cycle %u\t%s\n",
            m_currentScanLine,
-           (currentCPUCycle - m_lastCPUCycle) / 4);
+           (currentCPUCycle - m_lastCPUCycle) / 4,
+           modesNames[static_cast<uint8_t>(m_screenMode)]);
+#endif
 
     switch (m_screenMode)
     {
-    case ScreenMode::eSCREENMODE_oamsearch:
-        printf("Scanline OAM\n");
-        scanOAM(currentCPUCycle);
-        break;
-    case ScreenMode::eSCREENMODE_lcdtransfer:
-        printf("Scanline LCD transfer\n");
-        transferPixels(currentCPUCycle);
-        break;
-    case ScreenMode::eSCREENMODE_hblank:
-        printf("H-Blank\n");
-        enterHBlankPeriod(currentCPUCycle);
-        break;
-    case ScreenMode::eSCREENMODE_vblank:
-        printf("V-Blank\n");
-        enterVBlankPeriod(currentCPUCycle);
-        break;
+    case ScreenMode::eSCREENMODE_oamsearch: scanOAM(currentCPUCycle); break;
+    case ScreenMode::eSCREENMODE_lcdtransfer: transferPixels(currentCPUCycle); break;
+    case ScreenMode::eSCREENMODE_hblank: enterHBlankPeriod(currentCPUCycle); break;
+    case ScreenMode::eSCREENMODE_vblank: enterVBlankPeriod(currentCPUCycle); break;
     }
 }
 
@@ -100,6 +94,7 @@ void Ppu::transferPixels(const uint32_t currentCPUCycle)
     if (((currentCPUCycle - m_lastCPUCycle) / 4) == LCDTiming::eLCDTIME_pixeltransfer)
     {
         m_lastCPUCycle = currentCPUCycle;
+        renderScanline();
         switchState();
     }
 }
@@ -113,6 +108,10 @@ void Ppu::enterHBlankPeriod(const uint32_t currentCPUCycle)
         m_lastCPUCycle = currentCPUCycle;
 
         ++m_currentScanLine;
+        if (m_currentScanLine == eFrameHeight)
+        {
+            completeFrame();
+        }
 
         switchState();
     }
@@ -122,8 +121,10 @@ void Ppu::enterHBlankPeriod(const uint32_t currentCPUCycle)
 
 void Ppu::enterVBlankPeriod(const uint32_t currentCPUCycle)
 {
-    // if (((currentCPUCycle - m_lastCPUCycle) / 4) == LCDTiming::eLCDTIME_vblank)
-    if ((((currentCPUCycle - m_lastCPUCycle) / 4) % LCDTiming::eLCDTIME_onelinerender) == 0)
+    // The V-Blank lines are visible to the games too, the boot ROM waits for line 144.
+    m_mmu.writeByte(m_currentScanLine, HardwareIORegisters::eIOREG_ly);
+
+    if (((currentCPUCycle - m_lastCPUCycle) / 4) == LCDTiming::eLCDTIME_onelinerender)
     {
         m_lastCPUCycle = currentCPUCycle;
         ++m_currentScanLine;
@@ -137,3 +138,259 @@ void Ppu::enterVBlankPeriod(const uint32_t currentCPUCycle)
         switchState();
     }
 }
+
+// =================================================================================================
+
+void Ppu::setFrameSink(FrameSink* frameSink)
+{
+    m_frameSink = frameSink;
+    m_frameTarget = (m_frameSink != nullptr) ? m_frameSink->acquireFrame() : m_frameBuffer.data();
+}
+
+// =================================================================================================
+
+void Ppu::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_ppu, eStateVersion);
+
+    writer.write(m_lastCPUCycle);
+    writer.write(m_currentScanLine);
+    writer.write(m_windowLine);
+    writer.write(m_screenMode);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Ppu::loadState(StateReader& reader)
+{
+    return (reader.openSection(savestate::eSECTION_ppu) == true) &&
+           reader.read(m_lastCPUCycle) && reader.read(m_currentScanLine) &&
+           reader.read(m_windowLine) && reader.read(m_screenMode);
+}
+
+// =================================================================================================
+
+void Ppu::completeFrame()
+{
+    m_windowLine = 0;
+    ++m_framesCount;
+
+    if (m_frameDelta != nullptr)
+    {
+        m_frameDelta->update(m_frameTarget);
+    }
+
+    if (m_frameSink != nullptr)
+    {
+        // The sink may reuse the frame as soon as it is published.
+        std::copy(m_frameTarget, m_frameTarget + eFramePixels, m_frameBuffer.begin());
+        m_frameSink->publishFrame();
+        m_frameTarget = m_frameSink->acquireFrame();
+    }
+}
+
+// =================================================================================================
+
+void Ppu::renderScanline()
+{
+    if (m_currentScanLine >= eFrameHeight)
+    {
+        return;
+    }
+
+    uint32_t* const line = m_frameTarget + (m_currentScanLine * eFrameWidth);
+    const uint8_t lcdc = m_mmu.readByte(HardwareIORegisters::eIOREG_lcdc);
+    const bool cgbMode = (m_cgbPalettes != nullptr);
+
+    if ((lcdc & LCDControlBits::eLCDC_lcdenable) == 0)
+    {
+        std::fill(line, line + eFrameWidth, m_dmgShades[0]);
+        return;
+    }
+
+    // Resolved colors of every palette (palette * 4 + color number), so that each pixel costs a
+    // single table load whatever the mode.
+    const uint32_t* bgColors = nullptr;
+    const uint32_t* objColors = nullptr;
+    std::array<uint32_t, 4> dmgBGColors;
+    std::array<uint32_t, 8> dmgOBJColors;
+    if (cgbMode == true)
+    {
+        bgColors = m_cgbPalettes->getBGColors();
+        objColors = m_cgbPalettes->getOBJColors();
+    }
+    else
+    {
+        const uint8_t bgp = m_mmu.readByte(HardwareIORegisters::eIOREG_bgp);
+        const uint8_t obp0 = m_mmu.readByte(HardwareIORegisters::eIOREG_obp0);
+        const uint8_t obp1 = m_mmu.readByte(HardwareIORegisters::eIOREG_obp1);
+        for (uint8_t colorNum = 0; colorNum < 4; ++colorNum)
+        {
+            dmgBGColors[colorNum] = m_dmgShades[(bgp >> (colorNum * 2)) & 0x3];
+            dmgOBJColors[colorNum] = m_dmgShades[(obp0 >> (colorNum * 2)) & 0x3];
+            dmgOBJColors[4 + colorNum] = m_dmgShades[(obp1 >> (colorNum * 2)) & 0x3];
+        }
+        bgColors = dmgBGColors.data();
+        objColors = dmgOBJColors.data();
+    }
+
+    // Color numbers of the BG/Window pixels and their CGB priority bit, needed to resolve the
+    // sprites' priority.
+    std::array<uint8_t, eFrameWidth> bgColorNumbers{};
+    std::array<bool, eFrameWidth> bgPriorities{};
+
+    const bool unsignedTileData = (lcdc & LCDControlBits::eLCDC_tiledata) != 0;
+    const auto getTileDataOffset = [unsignedTileData](const uint8_t tileNum) -> uint16_t {
+        // 8000 method: unsigned tile number, 8800 method: signed tile number relative to 9000.
+        return unsignedTileData ? (tileNum * 16) : (0x1000 + (static_cast<int8_t>(tileNum) * 16));
+    };
+
+    // Render the BG or the Window pixel located at (tileX, tileY) in a tile map.
+    const auto renderBGPixel = [&](const uint16_t tileMapOffset,
+                                   const uint8_t tileX,
+                                   const uint8_t tileY,
+                                   const uint8_t x) {
+        const uint16_t mapOffset = tileMapOffset + ((tileY / 8) * 32) + (tileX / 8);
+        // In CGB mode, VRAM bank 1 holds the attributes of each tile of the map.
+        const uint8_t attributes = (cgbMode == true) ? m_vram[0x2000 + mapOffset] : 0;
+        const uint16_t bankOffset = ((attributes & 0x08) != 0) ? 0x2000 : 0;
+        const uint8_t row = ((attributes & 0x40) != 0) ? 7 - (tileY % 8) : (tileY % 8);
+        const uint8_t col = ((attributes & 0x20) != 0) ? 7 - (tileX % 8) : (tileX % 8);
+
+        const uint16_t tileRow = fetchTileRow(bankOffset + getTileDataOffset(m_vram[mapOffset]),
+                                              row);
+
+        bgColorNumbers[x] = getColorNumber(tileRow, col);
+        bgPriorities[x] = (attributes & 0x80) != 0;
+        line[x] = bgColors[((attributes & 0x07) * 4) + bgColorNumbers[x]];
+    };
+
+    // In CGB mode, LCDC bit 0 only removes the BG/Window priority over the sprites.
+    const bool bgEnabled = (cgbMode == true) || ((lcdc & LCDControlBits::eLCDC_bgenable) != 0);
+
+    // Background. =================================================================================
+    if (bgEnabled == true)
+    {
+        const uint16_t tileMapOffset = ((lcdc & LCDControlBits::eLCDC_bgtilemap) != 0) ? 0x1C00
+                                                                                       : 0x1800;
+        const uint8_t bgY = m_currentScanLine + m_mmu.readByte(HardwareIORegisters::eIOREG_scy);
+        const uint8_t scx = m_mmu.readByte(HardwareIORegisters::eIOREG_scx);
+
+        for (uint8_t x = 0; x < eFrameWidth; ++x)
+        {
+            renderBGPixel(tileMapOffset, x + scx, bgY, x);
+        }
+    }
+    else
+    {
+        std::fill(line, line + eFrameWidth, m_dmgShades[0]);
+    }
+
+    // Window. =====================================================================================
+    const uint8_t wy = m_mmu.readByte(HardwareIORegisters::eIOREG_wy);
+    const int16_t wx = m_mmu.readByte(HardwareIORegisters::eIOREG_wx) - 7;
+    if ((bgEnabled == true) && ((lcdc & LCDControlBits::eLCDC_windowenable) != 0) &&
+        (m_currentScanLine >= wy) && (wx < eFrameWidth))
+    {
+        const uint16_t tileMapOffset = ((lcdc & LCDControlBits::eLCDC_windowtilemap) != 0)
+                                           ? 0x1C00
+                                           : 0x1800;
+
+        for (int16_t x = std::max<int16_t>(wx, 0); x < eFrameWidth; ++x)
+        {
+            renderBGPixel(tileMapOffset, x - wx, m_windowLine, x);
+        }
+
+        ++m_windowLine;
+    }
+
+    // Sprites. ====================================================================================
+    if ((lcdc & LCDControlBits::eLCDC_objenable) != 0)
+    {
+        const uint8_t spriteHeight = ((lcdc & LCDControlBits::eLCDC_objsize) != 0) ? 16 : 8;
+        // CGB mode: LCDC bit 0 cleared puts the sprites above the BG/Window whatever their flags.
+        const bool bgMasterPriority = (cgbMode == false) ||
+                                      ((lcdc & LCDControlBits::eLCDC_bgenable) != 0);
+
+        // Only the first 10 sprites of the OAM located on this line are displayed.
+        std::array<uint16_t, 10> lineSprites;
+        uint8_t lineSpritesCount = 0;
+        for (uint16_t oamAddr = MemoryAreas::eMEMADDR_oamstart;
+             (oamAddr < MemoryAreas::eMEMADDDR_unusedramstart) && (lineSpritesCount < 10);
+             oamAddr += 4)
+        {
+            const int16_t spriteY = m_mmu.readByte(oamAddr) - 16;
+            if ((m_currentScanLine >= spriteY) && (m_currentScanLine < spriteY + spriteHeight))
+            {
+                lineSprites[lineSpritesCount++] = oamAddr;
+            }
+        }
+
+        // DMG mode: the sprite with the smallest X coordinate wins, then the first one in the
+        // OAM. CGB mode: only the OAM order matters.
+        if (cgbMode == false)
+        {
+            std::stable_sort(lineSprites.begin(),
+                             lineSprites.begin() + lineSpritesCount,
+                             [this](const uint16_t addr1, const uint16_t addr2) {
+                                 return m_mmu.readByte(addr1 + 1) < m_mmu.readByte(addr2 + 1);
+                             });
+        }
+
+        // Draw from the lowest to the highest priority sprite.
+        for (int8_t idx = lineSpritesCount - 1; idx >= 0; --idx)
+        {
+            const uint16_t oamAddr = lineSprites[idx];
+            const int16_t spriteY = m_mmu.readByte(oamAddr) - 16;
+            const int16_t spriteX = m_mmu.readByte(oamAddr + 1) - 8;
+            const uint8_t attributes = m_mmu.readByte(oamAddr + 3);
+            const bool behindBG = (attributes & 0x80) != 0;
+            const bool yFlip = (attributes & 0x40) != 0;
+            const bool xFlip = (attributes & 0x20) != 0;
+            const uint8_t palette = (cgbMode == true) ? (attributes & 0x07)
+                                                      : ((attributes >> 4) & 0x01);
+            const uint16_t bankOffset = ((cgbMode == true) && ((attributes & 0x08) != 0)) ? 0x2000
+                                                                                         : 0;
+
+            uint8_t tileNum = m_mmu.readByte(oamAddr + 2);
+            if (spriteHeight == 16)
+            {
+                tileNum &= 0xFE;
+            }
+
+            uint8_t row = m_currentScanLine - spriteY;
+            if (yFlip == true)
+            {
+                row = spriteHeight - 1 - row;
+            }
+
+            const uint16_t tileRow = fetchTileRow(bankOffset + (tileNum * 16), row);
+
+            for (uint8_t col = 0; col < 8; ++col)
+            {
+                const int16_t x = spriteX + col;
+                if ((x < 0) || (x >= eFrameWidth))
+                {
+                    continue;
+                }
+
+                const uint8_t colorNum = getColorNumber(tileRow, (xFlip == true) ? 7 - col : col);
+                // Color number 0 is transparent for sprites.
+                if (colorNum == 0)
+                {
+                    continue;
+                }
+
+                if ((bgMasterPriority == true) && (bgColorNumbers[x] != 0) &&
+                    ((behindBG == true) || (bgPriorities[x] == true)))
+                {
+                    continue;
+                }
+
+                line[x] = objColors[(palette * 4) + colorNum];
+            }
+        }
+    }
+}
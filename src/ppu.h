@@ -29,9 +29,15 @@
 #define PPU_H_
 
 #include "mmu.h"
+#include "framesink.h"
+#include "framedelta.h"
+#include "cgbpalettes.h"
+#include "savestate.h"
 
 #include "lcd.h"
 
+#include <array>
+
 // PPU timing:
 // ---------------
 // OAM search: 80 cycles.
@@ -42,10 +48,14 @@ class Ppu
 {
 public:
     explicit Ppu(Mmu& mmu) :
-        m_mmu(mmu), m_lastCPUCycle(0), m_currentScanLine(0),
-        m_screenMode(ScreenMode::eSCREENMODE_oamsearch)
+        m_mmu(mmu), m_lastCPUCycle(0), m_currentScanLine(0), m_windowLine(0),
+        m_screenMode(ScreenMode::eSCREENMODE_oamsearch), m_vram(nullptr), m_cgbPalettes(nullptr),
+        m_frameBuffer{}, m_frameSink(nullptr), m_frameDelta(nullptr),
+        m_frameTarget(m_frameBuffer.data()), m_framesCount(0)
     {
+#ifdef COLORBOY_DEBUG
         printf("OAM mode\n");
+#endif
     }
 
     /// \brief Run the PPU for one cycle.
@@ -53,7 +63,58 @@ public:
     /// \param currentCPUCycle the current CPU cycle.
     void cycle(const uint32_t currentCPUCycle);
 
+    /// \brief Set the video RAM read by the PPU.
+    ///
+    /// \param vram start of the VRAM banks (1 bank in DMG mode, 2 banks in CGB mode).
+    void setVRAM(const uint8_t* vram) { m_vram = vram; }
+
+    /// \brief Render the frames in CGB mode (VRAM bank 1 attributes and CGB palettes).
+    ///
+    /// \param cgbPalettes the CGB palettes memory, nullptr to render in DMG mode.
+    void setCGBPalettes(const CgbPalettes* cgbPalettes) { m_cgbPalettes = cgbPalettes; }
+
+    /// \brief Render the next frames into a frame sink instead of the PPU's own buffer.
+    ///
+    /// \param frameSink the frame sink, nullptr to go back to the PPU's own buffer.
+    void setFrameSink(FrameSink* frameSink);
+
+    /// \brief Compare each completed frame with the previous one before it is published.
+    ///
+    /// \param frameDelta receives the changes of each frame, nullptr to skip the comparison.
+    void setFrameDelta(FrameDelta* frameDelta) { m_frameDelta = frameDelta; }
+
+    /// \brief Get the last completed frame.
+    ///
+    /// Without a frame sink the frames are rendered in place: the frame is complete from the end
+    /// of its last line until the first line of the next one.
+    ///
+    /// \return pointer to the 160x144 RGBA8888 pixels.
+    const uint32_t* getFrame() const { return m_frameBuffer.data(); }
+
+    /// \brief Get the number of frames completed since the PPU was created.
+    uint64_t getFramesCount() const { return m_framesCount; }
+
+    /// \brief Write the PPU state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the PPU state.
+    ///
+    /// \return true if the state holds the PPU section, false otherwise.
+    bool loadState(StateReader& reader);
+
+    enum : uint16_t
+    {
+        eFrameWidth = 160,                          ///< LCD width in pixels.
+        eFrameHeight = 144,                         ///< LCD height in pixels.
+        eFramePixels = eFrameWidth * eFrameHeight,  ///< Pixels count of one frame.
+    };
+
 private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
     /// \brief Switch the PPU to its next state.
     void switchState();
 
@@ -62,6 +123,36 @@ private:
     void enterHBlankPeriod(const uint32_t currentCPUCycle);
     void enterVBlankPeriod(const uint32_t currentCPUCycle);
 
+    /// \brief Render the current scanline into the frame target.
+    void renderScanline();
+
+    /// \brief Hand the completed frame to the frame sink and get the next frame target.
+    void completeFrame();
+
+    /// \brief Read the two bytes of a tile's row from VRAM.
+    ///
+    /// \param tileDataOffset offset in the VRAM banks of the tile's first byte.
+    /// \param row tile's row from 0 to 7 (0 to 15 for 8x16 sprites).
+    ///
+    /// \return the row's low byte in bits 0-7 and its high byte in bits 8-15.
+    uint16_t fetchTileRow(const uint16_t tileDataOffset, const uint8_t row) const
+    {
+        return cbutil::combineTwoBytes(m_vram[tileDataOffset + (row * 2)],
+                                       m_vram[tileDataOffset + (row * 2) + 1]);
+    }
+
+    /// \brief Extract the color number (0 to 3) of a pixel from a tile's row.
+    ///
+    /// \param tileRow tile's row as returned by fetchTileRow.
+    /// \param col pixel's column from 0 (left) to 7 (right).
+    ///
+    /// \return the pixel's color number.
+    static uint8_t getColorNumber(const uint16_t tileRow, const uint8_t col)
+    {
+        const uint8_t bit = 7 - col;
+        return (((tileRow >> (8 + bit)) & 0x1) << 1) | ((tileRow >> bit) & 0x1);
+    }
+
     enum class ScreenMode : uint8_t
     {
         eSCREENMODE_hblank = 0,
@@ -73,7 +164,23 @@ private:
     Mmu& m_mmu;                 ///< Memory management unit.
     uint32_t m_lastCPUCycle;    ///< Last CPU cycle where the PPU processed data.
     uint8_t m_currentScanLine;  ///< Current horizontal line from 0 to 153.
+    uint8_t m_windowLine;       ///< Next line of the window to render.
     ScreenMode m_screenMode;    ///< Current operating mode of the screen.
+
+    const uint8_t* m_vram;              ///< VRAM banks.
+    const CgbPalettes* m_cgbPalettes;  ///< CGB palettes, nullptr in DMG mode.
+
+    std::array<uint32_t, eFramePixels> m_frameBuffer;  ///< Copy of the last completed frame.
+    FrameSink* m_frameSink;                            ///< Receives the completed frames.
+    FrameDelta* m_frameDelta;                          ///< Changes of the completed frames.
+    uint32_t* m_frameTarget;                           ///< Frame being rendered.
+    uint64_t m_framesCount;                            ///< Completed frames.
+
+    ///< RGBA8888 values of the 4 DMG shades of grey (white to black).
+    static constexpr std::array<uint32_t, 4> m_dmgShades = {0xFFFFFFFF,
+                                                            0xFFAAAAAA,
+                                                            0xFF555555,
+                                                            0xFF000000};
 };
 
 #endif /* PPU_H_ */
@@ -0,0 +1,310 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      rewindbuffer.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "rewindbuffer.h"
+
+#include "utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+// =================================================================================================
+//   Compressed state:
+//
+// Token     zero words count (varint) | literal words count (varint) | literal words
+// ...       until every 64 bits word of the state is covered
+// Tail      the last (size % 8) bytes, stored as is
+// =================================================================================================
+
+namespace
+{
+/// \brief Load a 64 bits word from an unaligned address.
+uint64_t loadWord(const uint8_t* data)
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/// \brief Store a 64 bits word at an unaligned address.
+void storeWord(uint8_t* data, const uint64_t word)
+{
+    std::memcpy(data, &word, sizeof(word));
+}
+
+/// \brief Write a LEB128 variable length integer.
+uint8_t* writeVarint(uint8_t* output, size_t value)
+{
+    while (value >= 0x80)
+    {
+        *output++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *output++ = static_cast<uint8_t>(value);
+
+    return output;
+}
+
+/// \brief Read a LEB128 variable length integer.
+const uint8_t* readVarint(const uint8_t* input, size_t& value)
+{
+    value = 0;
+    for (uint8_t shift = 0;; shift += 7)
+    {
+        const uint8_t byte = *input++;
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return input;
+        }
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+RewindBuffer::RewindBuffer(const size_t stateSize,
+                           const size_t budget,
+                           const uint32_t keyframeInterval) :
+    m_stateSize(stateSize), m_keyframeInterval(std::max(keyframeInterval, 1u)),
+    m_framesSinceKeyframe(0), m_previous(stateSize), m_dataHead(0), m_usedBytes(0),
+    m_firstEntry(0), m_count(0)
+{
+    // Worst case: a token of 1 zero word and 1 literal word for every 2 words.
+    const size_t wordsCount = stateSize / sizeof(uint64_t);
+    m_scratch.resize(stateSize + (((wordsCount / 2) + 1) * 2 * 10));
+
+    const size_t workingSize = m_previous.size() + m_scratch.size();
+    CBASSERT(budget > workingSize, "Rewind budget smaller than its working buffers");
+
+    // A sixteenth of the budget is for the frames' entries, the rest for the compressed states.
+    const size_t ringsSize = budget - workingSize;
+    m_entries.resize(std::max<size_t>(ringsSize / 16 / sizeof(Entry), 1));
+    m_data.resize(ringsSize - (m_entries.size() * sizeof(Entry)));
+}
+
+// =================================================================================================
+
+bool RewindBuffer::push(const uint8_t* state)
+{
+    bool keyframe = (m_count == 0) || (m_framesSinceKeyframe + 1 >= m_keyframeInterval);
+    size_t size = encode(state, (keyframe == true) ? nullptr : m_previous.data(), m_scratch.data());
+
+    if (m_count == m_entries.size())
+    {
+        evictOldest();
+    }
+
+    size_t offset = m_dataHead;
+    for (;;)
+    {
+        if (size > m_data.size())
+        {
+            return false;
+        }
+
+        if (offset + size > m_data.size())
+        {
+            // The end of the ring is skipped, the states stored there are the oldest ones.
+            while ((m_count > 0) && (getEntry(0).offset >= offset))
+            {
+                evictOldest();
+            }
+            offset = 0;
+        }
+
+        // The states are stored in order: the ones in the way are the oldest.
+        while (m_count > 0)
+        {
+            const Entry& oldest = getEntry(0);
+            if ((oldest.offset >= offset + size) || (offset >= oldest.offset + oldest.size))
+            {
+                break;
+            }
+            evictOldest();
+        }
+
+        // Making room may have evicted the keyframe of this delta.
+        if ((keyframe == true) || (m_count > 0))
+        {
+            break;
+        }
+
+        keyframe = true;
+        size = encode(state, nullptr, m_scratch.data());
+    }
+
+    std::memcpy(m_data.data() + offset, m_scratch.data(), size);
+    getEntry(m_count++) = {static_cast<uint32_t>(offset), static_cast<uint32_t>(size), keyframe};
+    m_dataHead = offset + size;
+    m_usedBytes += size;
+
+    m_framesSinceKeyframe = (keyframe == true) ? 0 : m_framesSinceKeyframe + 1;
+    std::memcpy(m_previous.data(), state, m_stateSize);
+
+    return true;
+}
+
+// =================================================================================================
+
+bool RewindBuffer::rewind(const uint32_t framesCount, uint8_t* state)
+{
+    if (framesCount >= m_count)
+    {
+        return false;
+    }
+
+    // The oldest frame is always a keyframe.
+    const uint32_t target = m_count - 1 - framesCount;
+    uint32_t keyframe = target;
+    while (getEntry(keyframe).keyframe == false)
+    {
+        --keyframe;
+    }
+
+    for (uint32_t frameIdx = keyframe; frameIdx <= target; ++frameIdx)
+    {
+        const Entry& entry = getEntry(frameIdx);
+        decode(m_data.data() + entry.offset, state, entry.keyframe == false);
+    }
+
+    // The frames after the target never happened.
+    for (uint32_t frameIdx = target + 1; frameIdx < m_count; ++frameIdx)
+    {
+        m_usedBytes -= getEntry(frameIdx).size;
+    }
+    m_count = target + 1;
+    m_dataHead = getEntry(target).offset + getEntry(target).size;
+    m_framesSinceKeyframe = target - keyframe;
+    std::memcpy(m_previous.data(), state, m_stateSize);
+
+    return true;
+}
+
+// =================================================================================================
+
+void RewindBuffer::clear()
+{
+    m_framesSinceKeyframe = 0;
+    m_dataHead = 0;
+    m_usedBytes = 0;
+    m_firstEntry = 0;
+    m_count = 0;
+}
+
+// =================================================================================================
+
+void RewindBuffer::evictOldest()
+{
+    // The deltas following the keyframe cannot be decoded without it.
+    do
+    {
+        m_usedBytes -= getEntry(0).size;
+        m_firstEntry = (m_firstEntry + 1) % m_entries.size();
+        --m_count;
+    } while ((m_count > 0) && (getEntry(0).keyframe == false));
+}
+
+// =================================================================================================
+
+size_t RewindBuffer::encode(const uint8_t* state, const uint8_t* reference, uint8_t* output) const
+{
+    const size_t wordsCount = m_stateSize / sizeof(uint64_t);
+    auto getWord = [state, reference](const size_t wordIdx) {
+        const size_t offset = wordIdx * sizeof(uint64_t);
+        return (reference == nullptr) ? loadWord(state + offset)
+                                      : loadWord(state + offset) ^ loadWord(reference + offset);
+    };
+
+    uint8_t* out = output;
+    size_t wordIdx = 0;
+    while (wordIdx < wordsCount)
+    {
+        const size_t zerosStart = wordIdx;
+        while ((wordIdx < wordsCount) && (getWord(wordIdx) == 0))
+        {
+            ++wordIdx;
+        }
+
+        const size_t literalsStart = wordIdx;
+        while ((wordIdx < wordsCount) && (getWord(wordIdx) != 0))
+        {
+            ++wordIdx;
+        }
+
+        out = writeVarint(out, literalsStart - zerosStart);
+        out = writeVarint(out, wordIdx - literalsStart);
+        for (size_t literalIdx = literalsStart; literalIdx < wordIdx; ++literalIdx)
+        {
+            storeWord(out, getWord(literalIdx));
+            out += sizeof(uint64_t);
+        }
+    }
+
+    for (size_t byteIdx = wordsCount * sizeof(uint64_t); byteIdx < m_stateSize; ++byteIdx)
+    {
+        *out++ = (reference == nullptr) ? state[byteIdx] : state[byteIdx] ^ reference[byteIdx];
+    }
+
+    return static_cast<size_t>(out - output);
+}
+
+// =================================================================================================
+
+void RewindBuffer::decode(const uint8_t* input, uint8_t* state, const bool delta) const
+{
+    const size_t wordsCount = m_stateSize / sizeof(uint64_t);
+
+    size_t wordIdx = 0;
+    while (wordIdx < wordsCount)
+    {
+        size_t zerosCount;
+        size_t literalsCount;
+        input = readVarint(input, zerosCount);
+        input = readVarint(input, literalsCount);
+
+        // A zero word of a delta leaves the previous state's word unchanged.
+        if (delta == false)
+        {
+            std::memset(state + (wordIdx * sizeof(uint64_t)), 0, zerosCount * sizeof(uint64_t));
+        }
+        wordIdx += zerosCount;
+
+        for (size_t literalIdx = 0; literalIdx < literalsCount; ++literalIdx, ++wordIdx)
+        {
+            uint8_t* const word = state + (wordIdx * sizeof(uint64_t));
+            storeWord(word, (delta == true) ? loadWord(word) ^ loadWord(input) : loadWord(input));
+            input += sizeof(uint64_t);
+        }
+    }
+
+    for (size_t byteIdx = wordsCount * sizeof(uint64_t); byteIdx < m_stateSize; ++byteIdx)
+    {
+        state[byteIdx] = (delta == true) ? state[byteIdx] ^ *input : *input;
+        ++input;
+    }
+}
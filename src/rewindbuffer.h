@@ -0,0 +1,135 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      rewindbuffer.h
+///
+/// \brief     Compressed history of the console's states.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef REWINDBUFFER_H_
+#define REWINDBUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// \brief Fixed size ring of save states, one per frame, to go back in time.
+///
+/// One state every keyframe interval is stored whole, the others as the XOR of the state with
+/// the previous one. Both are compressed by a run-length codec working on 64 bits words: the
+/// frames in between differ by a few bytes, so a delta is mostly runs of zero words. Going back
+/// N frames decodes at most one keyframe and the deltas that follow it.
+///
+/// Everything is allocated up front from the memory budget; when the ring is full the oldest
+/// keyframe is forgotten along with its deltas.
+class RewindBuffer
+{
+public:
+    enum : uint32_t
+    {
+        eKeyframeInterval = 60  ///< Default frames between two keyframes (one second).
+    };
+
+    /// \brief Constructor.
+    ///
+    /// \param stateSize size of every state, see Console::getStateSize().
+    /// \param budget memory the buffer may use in bytes, including its working buffers.
+    /// \param keyframeInterval frames between two keyframes.
+    RewindBuffer(const size_t stateSize,
+                 const size_t budget,
+                 const uint32_t keyframeInterval = eKeyframeInterval);
+
+    /// \brief Record the state of a new frame.
+    ///
+    /// \param state the frame's state, getStateSize() bytes.
+    ///
+    /// \return true if the state was recorded, false if it does not fit in the budget.
+    bool push(const uint8_t* state);
+
+    /// \brief Go back in time: restore an older state and forget the states that followed it.
+    ///
+    /// \param framesCount frames to go back, 0 restores the last recorded state.
+    /// \param[out] state receives the restored state, getStateSize() bytes.
+    ///
+    /// \return true if the state was restored, false if the history is shorter.
+    bool rewind(const uint32_t framesCount, uint8_t* state);
+
+    /// \brief Forget every recorded state.
+    void clear();
+
+    /// \brief Get the number of recorded frames.
+    uint32_t getFramesCount() const { return m_count; }
+
+    /// \brief Get the size of the compressed states held.
+    size_t getUsedBytes() const { return m_usedBytes; }
+
+    /// \brief Get the size of every state.
+    size_t getStateSize() const { return m_stateSize; }
+
+private:
+    /// \brief Location of a recorded frame in the data ring.
+    struct Entry
+    {
+        uint32_t offset;  ///< Offset of the compressed state.
+        uint32_t size;    ///< Size of the compressed state.
+        bool keyframe;    ///< Whole state or delta with the previous one?
+    };
+
+    /// \brief Get a recorded frame, 0 being the oldest.
+    Entry& getEntry(const uint32_t frameIdx)
+    {
+        return m_entries[(m_firstEntry + frameIdx) % m_entries.size()];
+    }
+
+    /// \brief Forget the oldest keyframe and its deltas.
+    void evictOldest();
+
+    /// \brief Compress a state, or its delta with a reference state.
+    ///
+    /// \param state state to compress.
+    /// \param reference previous state, nullptr to compress the whole state.
+    /// \param[out] output receives the compressed state, at least m_scratch.size() bytes.
+    ///
+    /// \return the size of the compressed state.
+    size_t encode(const uint8_t* state, const uint8_t* reference, uint8_t* output) const;
+
+    /// \brief Decompress a state, or apply a delta to the previous state.
+    ///
+    /// \param input compressed state.
+    /// \param[in,out] state receives the whole state, or holds the previous state to update.
+    /// \param delta is the input a delta?
+    void decode(const uint8_t* input, uint8_t* state, const bool delta) const;
+
+    size_t m_stateSize;               ///< Size of every state.
+    uint32_t m_keyframeInterval;      ///< Frames between two keyframes.
+    uint32_t m_framesSinceKeyframe;   ///< Deltas recorded after the last keyframe.
+    std::vector<uint8_t> m_previous;  ///< Last recorded state, reference of the next delta.
+    std::vector<uint8_t> m_scratch;   ///< Compression output.
+    std::vector<uint8_t> m_data;      ///< Ring of compressed states.
+    size_t m_dataHead;                ///< Offset following the last compressed state.
+    size_t m_usedBytes;               ///< Size of the compressed states held.
+    std::vector<Entry> m_entries;     ///< Ring of recorded frames.
+    uint32_t m_firstEntry;            ///< Index of the oldest frame in m_entries.
+    uint32_t m_count;                 ///< Number of recorded frames.
+};
+
+#endif /* REWINDBUFFER_H_ */
@@ -0,0 +1,202 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      savestate.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "savestate.h"
+
+#include "utils.h"
+
+StateWriter::StateWriter(uint8_t* buffer, const size_t capacity) :
+    m_buffer(buffer), m_capacity((buffer != nullptr) ? capacity : 0),
+    m_size(savestate::eHeaderSize), m_sectionStart(0), m_sectionsCount(0)
+{
+}
+
+// =================================================================================================
+
+void StateWriter::beginSection(const uint32_t tag, const uint16_t version)
+{
+    CBASSERT(m_sectionsCount < savestate::eMaxSections, "Too many state sections");
+
+    m_sectionStart = m_size;
+    m_sections[m_sectionsCount] = {tag, version, 0};
+    m_size += savestate::eSectionHeaderSize;
+}
+
+// =================================================================================================
+
+void StateWriter::endSection()
+{
+    savestate::SectionInfo& section = m_sections[m_sectionsCount++];
+    section.size =
+        static_cast<uint32_t>(m_size - m_sectionStart - savestate::eSectionHeaderSize);
+
+    patch(m_sectionStart, section.tag);
+    patch(m_sectionStart + 4, section.version);
+    patch(m_sectionStart + 6, uint16_t(0));
+    patch(m_sectionStart + 8, section.size);
+}
+
+// =================================================================================================
+
+size_t StateWriter::finish()
+{
+    patch(0, static_cast<uint32_t>(savestate::eMagic));
+    patch(4, static_cast<uint16_t>(savestate::eVersion));
+    patch(6, m_sectionsCount);
+    patch(8, static_cast<uint32_t>(m_size));
+    patch(12, uint32_t(0));
+
+    return m_size;
+}
+
+// =================================================================================================
+
+StateReader::StateReader(const uint8_t* buffer, const size_t size) :
+    m_buffer(buffer), m_size(size), m_valid(false), m_cursor(0), m_sectionEnd(0)
+{
+    if ((buffer == nullptr) || (size < savestate::eHeaderSize))
+    {
+        return;
+    }
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t sectionsCount;
+    uint32_t stateSize;
+    std::memcpy(&magic, buffer, sizeof(magic));
+    std::memcpy(&version, buffer + 4, sizeof(version));
+    std::memcpy(&sectionsCount, buffer + 6, sizeof(sectionsCount));
+    std::memcpy(&stateSize, buffer + 8, sizeof(stateSize));
+
+    if ((magic != savestate::eMagic) || (version != savestate::eVersion) || (stateSize > size))
+    {
+        return;
+    }
+    m_size = stateSize;
+
+    // Every section must lie inside the state.
+    size_t offset = savestate::eHeaderSize;
+    for (uint16_t sectionIdx = 0; sectionIdx < sectionsCount; ++sectionIdx)
+    {
+        uint32_t sectionSize;
+        if (offset + savestate::eSectionHeaderSize > m_size)
+        {
+            return;
+        }
+        std::memcpy(&sectionSize, buffer + offset + 8, sizeof(sectionSize));
+
+        offset += savestate::eSectionHeaderSize + sectionSize;
+        if (offset > m_size)
+        {
+            return;
+        }
+    }
+
+    m_valid = (offset == m_size);
+}
+
+// =================================================================================================
+
+bool StateReader::hasSection(const savestate::SectionInfo& info) const
+{
+    const size_t offset = findSection(info.tag);
+    if (offset == 0)
+    {
+        return false;
+    }
+
+    uint16_t version;
+    uint32_t size;
+    std::memcpy(&version, m_buffer + offset + 4, sizeof(version));
+    std::memcpy(&size, m_buffer + offset + 8, sizeof(size));
+
+    return (version == info.version) && (size == info.size);
+}
+
+// =================================================================================================
+
+const uint8_t* StateReader::getSectionData(const uint32_t tag, size_t& size) const
+{
+    const size_t offset = findSection(tag);
+    if (offset == 0)
+    {
+        size = 0;
+        return nullptr;
+    }
+
+    uint32_t sectionSize;
+    std::memcpy(&sectionSize, m_buffer + offset + 8, sizeof(sectionSize));
+    size = sectionSize;
+
+    return m_buffer + offset + savestate::eSectionHeaderSize;
+}
+
+// =================================================================================================
+
+bool StateReader::openSection(const uint32_t tag)
+{
+    const size_t offset = findSection(tag);
+    if (offset == 0)
+    {
+        return false;
+    }
+
+    uint32_t size;
+    std::memcpy(&size, m_buffer + offset + 8, sizeof(size));
+
+    m_cursor = offset + savestate::eSectionHeaderSize;
+    m_sectionEnd = m_cursor + size;
+
+    return true;
+}
+
+// =================================================================================================
+
+size_t StateReader::findSection(const uint32_t tag) const
+{
+    if (m_valid == false)
+    {
+        return 0;
+    }
+
+    size_t offset = savestate::eHeaderSize;
+    while (offset < m_size)
+    {
+        uint32_t sectionTag;
+        uint32_t sectionSize;
+        std::memcpy(&sectionTag, m_buffer + offset, sizeof(sectionTag));
+        std::memcpy(&sectionSize, m_buffer + offset + 8, sizeof(sectionSize));
+
+        if (sectionTag == tag)
+        {
+            return offset;
+        }
+
+        offset += savestate::eSectionHeaderSize + sectionSize;
+    }
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      savestate.h
+///
+/// \brief     Versioned, section tagged binary snapshots of a console.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SAVESTATE_H_
+#define SAVESTATE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// =================================================================================================
+//   Layout of a state:
+//
+// Header    magic "CBST" (4) | format version (2) | sections count (2) | total size (4) | 0 (4)
+// Section   tag (4) | section version (2) | 0 (2) | payload size (4) | payload
+// ...
+//
+// Every value is stored in the host's byte order: a state is meant to be loaded back on the
+// machine that saved it (rewind, run-ahead), not exchanged.
+// =================================================================================================
+
+namespace savestate
+{
+/// \brief Build a section tag from its 4 characters name.
+constexpr uint32_t makeTag(const char (&name)[5])
+{
+    return static_cast<uint32_t>(name[0]) | (static_cast<uint32_t>(name[1]) << 8) |
+           (static_cast<uint32_t>(name[2]) << 16) | (static_cast<uint32_t>(name[3]) << 24);
+}
+
+enum : uint32_t
+{
+    eMagic = makeTag("CBST"),  ///< First bytes of every state.
+    eVersion = 1,              ///< Format version, bumped on every incompatible change.
+    eHeaderSize = 16,          ///< Size of the state's header.
+    eSectionHeaderSize = 12,   ///< Size of a section's header.
+    eMaxSections = 16          ///< Sections a state may hold.
+};
+
+/// \brief Tags of the sections.
+enum SectionTag : uint32_t
+{
+    eSECTION_console = makeTag("CONS"),    ///< Console's banks selection.
+    eSECTION_memory = makeTag("MEM "),     ///< Fixed memory, VRAM, WRAM, cartridge RAM.
+    eSECTION_cpu = makeTag("CPU "),        ///< CPU registers and instruction cycle.
+    eSECTION_ppu = makeTag("PPU "),        ///< PPU mode and position.
+    eSECTION_palettes = makeTag("CPAL"),   ///< CGB palettes.
+    eSECTION_scheduler = makeTag("SCHD"),  ///< Master clock and events deadlines.
+    eSECTION_timer = makeTag("TIMR"),      ///< Divider and timer.
+    eSECTION_apu = makeTag("APU "),        ///< Sound registers and channels.
+    eSECTION_joypad = makeTag("JOYP"),     ///< Pressed buttons and selected lines.
+    eSECTION_serial = makeTag("SERL")      ///< Serial transfer registers.
+};
+
+/// \brief Tag, version and size of a section.
+struct SectionInfo
+{
+    uint32_t tag;
+    uint16_t version;
+    uint32_t size;
+};
+
+}  // namespace savestate
+
+/// \brief Writes a state into a caller provided buffer, without any allocation.
+///
+/// Without a buffer the writer only measures the state.
+class StateWriter
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param buffer destination of the state, may be nullptr to only measure it.
+    /// \param capacity size of the buffer in bytes.
+    StateWriter(uint8_t* buffer, const size_t capacity);
+
+    /// \brief Start a section.
+    ///
+    /// \param tag section tag.
+    /// \param version version of the section's payload.
+    void beginSection(const uint32_t tag, const uint16_t version);
+
+    /// \brief End the current section.
+    void endSection();
+
+    /// \brief Write a value.
+    template<typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be written");
+        writeBytes(&value, sizeof(T));
+    }
+
+    /// \brief Write a memory block.
+    void writeBytes(const void* data, const size_t size)
+    {
+        if ((m_buffer != nullptr) && (m_size + size <= m_capacity))
+        {
+            std::memcpy(m_buffer + m_size, data, size);
+        }
+        m_size += size;
+    }
+
+    /// \brief Complete the state's header.
+    ///
+    /// \return the size of the state, larger than the capacity if the buffer was too small.
+    size_t finish();
+
+    /// \brief Check if the state did not fit in the buffer.
+    bool hasOverflowed() const { return m_size > m_capacity; }
+
+    /// \brief Get the sections written so far.
+    const savestate::SectionInfo* getSections() const { return m_sections.data(); }
+
+    /// \brief Get the number of sections written so far.
+    uint16_t getSectionsCount() const { return m_sectionsCount; }
+
+private:
+    /// \brief Write a value at a given offset, if it fits.
+    template<typename T>
+    void patch(const size_t offset, const T& value)
+    {
+        if ((m_buffer != nullptr) && (offset + sizeof(T) <= m_capacity))
+        {
+            std::memcpy(m_buffer + offset, &value, sizeof(T));
+        }
+    }
+
+    uint8_t* m_buffer;      ///< Destination of the state.
+    size_t m_capacity;      ///< Size of the destination.
+    size_t m_size;          ///< Bytes written so far.
+    size_t m_sectionStart;  ///< Offset of the current section's header.
+
+    std::array<savestate::SectionInfo, savestate::eMaxSections> m_sections;  ///< Written sections.
+    uint16_t m_sectionsCount;                                               ///< Number of sections.
+};
+
+/// \brief Reads the sections of a state.
+class StateReader
+{
+public:
+    /// \brief Constructor, checks the state's header and sections table.
+    ///
+    /// \param buffer the state.
+    /// \param size size of the state in bytes.
+    StateReader(const uint8_t* buffer, const size_t size);
+
+    /// \brief Check if the state is well formed.
+    bool isValid() const { return m_valid; }
+
+    /// \brief Check if the state holds a section with the given version and size.
+    bool hasSection(const savestate::SectionInfo& info) const;
+
+    /// \brief Get the payload of a section.
+    ///
+    /// \param tag section tag.
+    /// \param[out] size receives the size of the payload.
+    ///
+    /// \return the payload, nullptr if the section does not exist.
+    const uint8_t* getSectionData(const uint32_t tag, size_t& size) const;
+
+    /// \brief Start reading a section.
+    ///
+    /// \param tag section tag.
+    ///
+    /// \return true if the section exists, false otherwise.
+    bool openSection(const uint32_t tag);
+
+    /// \brief Read a value from the current section.
+    template<typename T>
+    bool read(T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be read");
+        return readBytes(&value, sizeof(T));
+    }
+
+    /// \brief Read a memory block from the current section.
+    bool readBytes(void* data, const size_t size)
+    {
+        if (m_cursor + size > m_sectionEnd)
+        {
+            return false;
+        }
+
+        std::memcpy(data, m_buffer + m_cursor, size);
+        m_cursor += size;
+        return true;
+    }
+
+private:
+    /// \brief Find a section.
+    ///
+    /// \return the offset of the section's header, 0 if it does not exist.
+    size_t findSection(const uint32_t tag) const;
+
+    const uint8_t* m_buffer;  ///< The state.
+    size_t m_size;            ///< Size of the state.
+    bool m_valid;             ///< Is the state well formed?
+    size_t m_cursor;          ///< Next byte to read.
+    size_t m_sectionEnd;      ///< End of the current section.
+};
+
+#endif /* SAVESTATE_H_ */
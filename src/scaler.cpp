@@ -0,0 +1,330 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      scaler.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "scaler.h"
+
+#include "utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+/// \brief Nearest neighbour scaling of one line.
+///
+/// \param src source line.
+/// \param dst first destination line, the factor - 1 next ones are copies of it.
+/// \param width source line width.
+/// \param factor scaling factor (2 to 4).
+void scaleNearestLine(const uint32_t* src,
+                      uint32_t* dst,
+                      const uint16_t width,
+                      const uint8_t factor)
+{
+    uint16_t x = 0;
+
+#ifdef __SSE2__
+    // 4 source pixels at once, replicated with 32-bit lanes shuffles.
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        __m128i* out = reinterpret_cast<__m128i*>(dst + (x * factor));
+
+        switch (factor)
+        {
+        case 2:
+            _mm_storeu_si128(out, _mm_unpacklo_epi32(pixels, pixels));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi32(pixels, pixels));
+            break;
+        case 3:
+            _mm_storeu_si128(out, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 0, 0)));
+            _mm_storeu_si128(out + 1, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 1, 1)));
+            _mm_storeu_si128(out + 2, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 2)));
+            break;
+        case 4:
+            _mm_storeu_si128(out, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 0, 0, 0)));
+            _mm_storeu_si128(out + 1, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_storeu_si128(out + 2, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 2, 2)));
+            _mm_storeu_si128(out + 3, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 3)));
+            break;
+        }
+    }
+#endif
+
+    for (; x < width; ++x)
+    {
+        for (uint8_t rep = 0; rep < factor; ++rep)
+        {
+            dst[(x * factor) + rep] = src[x];
+        }
+    }
+
+    const size_t dstWidth = width * factor;
+    for (uint8_t rep = 1; rep < factor; ++rep)
+    {
+        std::memcpy(dst + (rep * dstWidth), dst, dstWidth * sizeof(uint32_t));
+    }
+}
+
+// =================================================================================================
+
+/// \brief Scale2x of the pixel E given its neighbours B (up), D (left), F (right), H (down).
+void scale2xPixel(const uint32_t B, const uint32_t D, const uint32_t E, const uint32_t F,
+                  const uint32_t H, uint32_t* out0, uint32_t* out1)
+{
+    if ((B != H) && (D != F))
+    {
+        out0[0] = (D == B) ? D : E;
+        out0[1] = (B == F) ? F : E;
+        out1[0] = (D == H) ? D : E;
+        out1[1] = (H == F) ? F : E;
+    }
+    else
+    {
+        out0[0] = out0[1] = out1[0] = out1[1] = E;
+    }
+}
+
+/// \brief Scale2x of one line.
+///
+/// \param up previous source line (the line itself on the first one).
+/// \param src source line.
+/// \param down next source line (the line itself on the last one).
+/// \param dst first of the two destination lines.
+/// \param width source line width.
+void scale2xLine(const uint32_t* up, const uint32_t* src, const uint32_t* down, uint32_t* dst,
+                 const uint16_t width)
+{
+    uint32_t* const dst0 = dst;
+    uint32_t* const dst1 = dst + (width * 2);
+
+    const auto scalarPixel = [&](const uint16_t x) {
+        const uint32_t D = src[(x > 0) ? x - 1 : x];
+        const uint32_t F = src[(x + 1 < width) ? x + 1 : x];
+        scale2xPixel(up[x], D, src[x], F, down[x], dst0 + (x * 2), dst1 + (x * 2));
+    };
+
+    uint16_t x = 0;
+
+#ifdef __SSE2__
+    // The first and last 4 pixels need clamped neighbours: leave them to the scalar path.
+    for (; (x < 4) && (x < width); ++x)
+    {
+        scalarPixel(x);
+    }
+
+    const auto select = [](const __m128i cond, const __m128i a, const __m128i b) {
+        return _mm_or_si128(_mm_and_si128(cond, a), _mm_andnot_si128(cond, b));
+    };
+
+    for (; x + 8 <= width; x += 4)
+    {
+        const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(up + x));
+        const __m128i H = _mm_loadu_si128(reinterpret_cast<const __m128i*>(down + x));
+        const __m128i D = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x - 1));
+        const __m128i E = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        const __m128i F = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x + 1));
+
+        const __m128i DeqB = _mm_cmpeq_epi32(D, B);
+        const __m128i BeqF = _mm_cmpeq_epi32(B, F);
+        const __m128i DeqH = _mm_cmpeq_epi32(D, H);
+        const __m128i HeqF = _mm_cmpeq_epi32(H, F);
+        // B != H && D != F.
+        const __m128i active = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi32(B, H),
+                                                             _mm_cmpeq_epi32(D, F)),
+                                                _mm_set1_epi32(-1));
+
+        const __m128i E0 = select(_mm_and_si128(active, DeqB), D, E);
+        const __m128i E1 = select(_mm_and_si128(active, BeqF), F, E);
+        const __m128i E2 = select(_mm_and_si128(active, DeqH), D, E);
+        const __m128i E3 = select(_mm_and_si128(active, HeqF), F, E);
+
+        __m128i* out0 = reinterpret_cast<__m128i*>(dst0 + (x * 2));
+        __m128i* out1 = reinterpret_cast<__m128i*>(dst1 + (x * 2));
+        _mm_storeu_si128(out0, _mm_unpacklo_epi32(E0, E1));
+        _mm_storeu_si128(out0 + 1, _mm_unpackhi_epi32(E0, E1));
+        _mm_storeu_si128(out1, _mm_unpacklo_epi32(E2, E3));
+        _mm_storeu_si128(out1 + 1, _mm_unpackhi_epi32(E2, E3));
+    }
+#endif
+
+    for (; x < width; ++x)
+    {
+        scalarPixel(x);
+    }
+}
+
+// =================================================================================================
+
+/// \brief Scale3x of one line.
+///
+/// \param up previous source line (the line itself on the first one).
+/// \param src source line.
+/// \param down next source line (the line itself on the last one).
+/// \param dst first of the three destination lines.
+/// \param width source line width.
+void scale3xLine(const uint32_t* up, const uint32_t* src, const uint32_t* down, uint32_t* dst,
+                 const uint16_t width)
+{
+    uint32_t* const dst0 = dst;
+    uint32_t* const dst1 = dst + (width * 3);
+    uint32_t* const dst2 = dst + (width * 6);
+
+    for (uint16_t x = 0; x < width; ++x)
+    {
+        const uint16_t left = (x > 0) ? x - 1 : x;
+        const uint16_t right = (x + 1 < width) ? x + 1 : x;
+
+        // A B C
+        // D E F
+        // G H I
+        const uint32_t A = up[left], B = up[x], C = up[right];
+        const uint32_t D = src[left], E = src[x], F = src[right];
+        const uint32_t G = down[left], H = down[x], I = down[right];
+
+        uint32_t* const out0 = dst0 + (x * 3);
+        uint32_t* const out1 = dst1 + (x * 3);
+        uint32_t* const out2 = dst2 + (x * 3);
+
+        if ((B != H) && (D != F))
+        {
+            out0[0] = (D == B) ? D : E;
+            out0[1] = (((D == B) && (E != C)) || ((B == F) && (E != A))) ? B : E;
+            out0[2] = (B == F) ? F : E;
+            out1[0] = (((D == B) && (E != G)) || ((D == H) && (E != A))) ? D : E;
+            out1[1] = E;
+            out1[2] = (((B == F) && (E != I)) || ((H == F) && (E != C))) ? F : E;
+            out2[0] = (D == H) ? D : E;
+            out2[1] = (((D == H) && (E != I)) || ((H == F) && (E != G))) ? H : E;
+            out2[2] = (H == F) ? F : E;
+        }
+        else
+        {
+            out0[0] = out0[1] = out0[2] = E;
+            out1[0] = out1[1] = out1[2] = E;
+            out2[0] = out2[1] = out2[2] = E;
+        }
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+Scaler::Scaler(const uint16_t width, const uint16_t height) :
+    m_width(width), m_height(height), m_filter(ScaleFilter::eSCALEFILTER_none), m_output(nullptr),
+    m_threadPool(nullptr), m_source(width * height)
+{
+}
+
+// =================================================================================================
+
+uint8_t Scaler::getScaleFactor(const ScaleFilter filter)
+{
+    switch (filter)
+    {
+    case ScaleFilter::eSCALEFILTER_none: return 1;
+    case ScaleFilter::eSCALEFILTER_nearest2x:
+    case ScaleFilter::eSCALEFILTER_scale2x: return 2;
+    case ScaleFilter::eSCALEFILTER_nearest3x:
+    case ScaleFilter::eSCALEFILTER_scale3x: return 3;
+    case ScaleFilter::eSCALEFILTER_nearest4x: return 4;
+    }
+
+    return 1;
+}
+
+// =================================================================================================
+
+void Scaler::publishFrame()
+{
+    CBASSERT(m_output != nullptr, "Scaler used without output");
+
+    scale(m_source.data(), m_output->acquireFrame());
+    m_output->publishFrame();
+}
+
+// =================================================================================================
+
+void Scaler::scale(const uint32_t* src, uint32_t* dst) const
+{
+    const uint32_t bandsCount = (m_height + eBandHeight - 1) / eBandHeight;
+
+    const auto scaleTask = [&](const uint32_t band) {
+        const uint16_t firstLine = band * eBandHeight;
+        const uint16_t lastLine = std::min<uint16_t>(firstLine + eBandHeight, m_height);
+        scaleBand(src, dst, firstLine, lastLine);
+    };
+
+    if (m_threadPool != nullptr)
+    {
+        m_threadPool->parallelFor(bandsCount, scaleTask);
+    }
+    else
+    {
+        for (uint32_t band = 0; band < bandsCount; ++band)
+        {
+            scaleTask(band);
+        }
+    }
+}
+
+// =================================================================================================
+
+void Scaler::scaleBand(const uint32_t* src,
+                       uint32_t* dst,
+                       const uint16_t firstLine,
+                       const uint16_t lastLine) const
+{
+    const uint8_t factor = getScaleFactor(m_filter);
+    const size_t dstLineSize = m_width * factor;
+
+    for (uint16_t y = firstLine; y < lastLine; ++y)
+    {
+        const uint32_t* const line = src + (y * m_width);
+        const uint32_t* const up = (y > 0) ? line - m_width : line;
+        const uint32_t* const down = (y + 1 < m_height) ? line + m_width : line;
+        uint32_t* const out = dst + (y * factor * dstLineSize);
+
+        switch (m_filter)
+        {
+        case ScaleFilter::eSCALEFILTER_none:
+            std::memcpy(out, line, m_width * sizeof(uint32_t));
+            break;
+        case ScaleFilter::eSCALEFILTER_nearest2x:
+        case ScaleFilter::eSCALEFILTER_nearest3x:
+        case ScaleFilter::eSCALEFILTER_nearest4x:
+            scaleNearestLine(line, out, m_width, factor);
+            break;
+        case ScaleFilter::eSCALEFILTER_scale2x: scale2xLine(up, line, down, out, m_width); break;
+        case ScaleFilter::eSCALEFILTER_scale3x: scale3xLine(up, line, down, out, m_width); break;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      scaler.h
+///
+/// \brief     Post-process stage upscaling the PPU frames.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SCALER_H_
+#define SCALER_H_
+
+#include "framesink.h"
+#include "threadpool.h"
+
+#include <cstdint>
+#include <vector>
+
+/// \brief Upscaling filters.
+enum class ScaleFilter : uint8_t
+{
+    eSCALEFILTER_none,       ///< No scaling.
+    eSCALEFILTER_nearest2x,  ///< Nearest neighbour, 2x.
+    eSCALEFILTER_nearest3x,  ///< Nearest neighbour, 3x.
+    eSCALEFILTER_nearest4x,  ///< Nearest neighbour, 4x.
+    eSCALEFILTER_scale2x,    ///< Scale2x (AdvMAME2x) edge interpolation.
+    eSCALEFILTER_scale3x     ///< Scale3x (AdvMAME3x) edge interpolation.
+};
+
+/// \brief Post-process stage upscaling the PPU frames.
+///
+/// The PPU renders into the scaler's native resolution buffer, then the scaler writes the scaled
+/// frame straight into the buffer of its output sink. The frame is split in bands of 8 source
+/// lines (one row of tiles) scaled in parallel on a thread pool.
+class Scaler : public FrameSink
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param width source frames width in pixels.
+    /// \param height source frames height in pixels.
+    Scaler(const uint16_t width, const uint16_t height);
+
+    /// \brief Get the scaling factor of a filter.
+    static uint8_t getScaleFactor(const ScaleFilter filter);
+
+    /// \brief Select the scaling filter.
+    void setFilter(const ScaleFilter filter) { m_filter = filter; }
+
+    /// \brief Get the scaling filter.
+    ScaleFilter getFilter() const { return m_filter; }
+
+    /// \brief Set the sink receiving the scaled frames.
+    void setOutput(FrameSink* output) { m_output = output; }
+
+    /// \brief Set the thread pool used to scale the bands, nullptr to scale on the caller thread.
+    void setThreadPool(ThreadPool* threadPool) { m_threadPool = threadPool; }
+
+    /// \brief Scale a whole frame.
+    ///
+    /// \param src source frame (width x height pixels).
+    /// \param dst destination frame (width x height x factor^2 pixels).
+    void scale(const uint32_t* src, uint32_t* dst) const;
+
+    uint32_t* acquireFrame() override { return m_source.data(); }
+    void publishFrame() override;
+
+private:
+    /// \brief Scale the source lines [firstLine, lastLine).
+    void scaleBand(const uint32_t* src,
+                   uint32_t* dst,
+                   const uint16_t firstLine,
+                   const uint16_t lastLine) const;
+
+    enum : uint8_t
+    {
+        eBandHeight = 8  ///< Source lines scaled by each task.
+    };
+
+    uint16_t m_width;                ///< Source frames width.
+    uint16_t m_height;               ///< Source frames height.
+    ScaleFilter m_filter;            ///< Active filter.
+    FrameSink* m_output;             ///< Receives the scaled frames.
+    ThreadPool* m_threadPool;        ///< Runs the bands in parallel.
+    std::vector<uint32_t> m_source;  ///< Frame rendered by the PPU.
+};
+
+#endif /* SCALER_H_ */
@@ -0,0 +1,81 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      scheduler.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "scheduler.h"
+
+#include <algorithm>
+
+void Scheduler::schedule(const SchedulerEvent event, const uint64_t deadline)
+{
+    m_deadlines[static_cast<uint8_t>(event)] = deadline;
+    updateNextDeadline();
+}
+
+// =================================================================================================
+
+void Scheduler::runNextEvent()
+{
+    const auto nextEvent = std::min_element(m_deadlines.begin(), m_deadlines.end());
+    const uint64_t deadline = *nextEvent;
+    const uint8_t eventIdx = static_cast<uint8_t>(std::distance(m_deadlines.begin(), nextEvent));
+
+    // The handler usually schedules the event again.
+    *nextEvent = eNever;
+    updateNextDeadline();
+
+    m_handlers[eventIdx](deadline);
+}
+
+// =================================================================================================
+
+void Scheduler::updateNextDeadline()
+{
+    m_nextDeadline = *std::min_element(m_deadlines.begin(), m_deadlines.end());
+}
+
+// =================================================================================================
+
+void Scheduler::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_scheduler, eStateVersion);
+
+    writer.write(m_now);
+    writer.write(m_deadlines);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Scheduler::loadState(StateReader& reader)
+{
+    const bool loaded = (reader.openSection(savestate::eSECTION_scheduler) == true) &&
+                        reader.read(m_now) && reader.read(m_deadlines);
+
+    updateNextDeadline();
+
+    return loaded;
+}
@@ -0,0 +1,128 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      scheduler.h
+///
+/// \brief     Master clock and timed events of the console's components.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include "savestate.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+/// \brief Events a component can schedule.
+enum class SchedulerEvent : uint8_t
+{
+    eSCHEDEVENT_apuframesequencer,  ///< APU frame sequencer step (512 Hz).
+    eSCHEDEVENT_timeroverflow,      ///< TIMA overflow.
+    eSCHEDEVENT_serialtransfer,     ///< End of a serial transfer.
+    eSCHEDEVENT_count
+};
+
+/// \brief Master clock of the console and queue of the events of its components.
+///
+/// Instead of being stepped on every clock, a component computes when its next observable
+/// change happens and schedules an event at that time. Advancing the clock only compares it
+/// with the nearest deadline.
+class Scheduler
+{
+public:
+    /// \brief Called when an event is due.
+    ///
+    /// \param deadline clock at which the event was due, at most a few clocks in the past.
+    using EventHandler = std::function<void(const uint64_t deadline)>;
+
+    static constexpr uint64_t eNever = std::numeric_limits<uint64_t>::max();  ///< No deadline.
+
+    Scheduler() { m_deadlines.fill(eNever); }
+
+    /// \brief Set the function called when an event is due.
+    void setHandler(const SchedulerEvent event, EventHandler handler)
+    {
+        m_handlers[static_cast<uint8_t>(event)] = std::move(handler);
+    }
+
+    /// \brief Schedule an event, replacing its previous deadline if any.
+    ///
+    /// \param event event to schedule.
+    /// \param deadline master clock value at which the event is due.
+    void schedule(const SchedulerEvent event, const uint64_t deadline);
+
+    /// \brief Cancel an event.
+    void cancel(const SchedulerEvent event) { schedule(event, eNever); }
+
+    /// \brief Check if an event is scheduled.
+    bool isScheduled(const SchedulerEvent event) const
+    {
+        return m_deadlines[static_cast<uint8_t>(event)] != eNever;
+    }
+
+    /// \brief Advance the master clock and run the events that became due.
+    ///
+    /// \param clocks number of clocks elapsed.
+    void advance(const uint32_t clocks)
+    {
+        m_now += clocks;
+        while (m_nextDeadline <= m_now)
+        {
+            runNextEvent();
+        }
+    }
+
+    /// \brief Get the master clock value.
+    uint64_t getNow() const { return m_now; }
+
+    /// \brief Write the master clock and the deadlines.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the master clock and the deadlines, the handlers stay the same.
+    ///
+    /// \return true if the state holds the scheduler section, false otherwise.
+    bool loadState(StateReader& reader);
+
+private:
+    /// \brief Run the event with the nearest deadline.
+    void runNextEvent();
+
+    /// \brief Find the nearest deadline.
+    void updateNextDeadline();
+
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    static constexpr uint8_t eEventsCount = static_cast<uint8_t>(SchedulerEvent::eSCHEDEVENT_count);
+
+    uint64_t m_now = 0;                                 ///< Master clock.
+    uint64_t m_nextDeadline = eNever;                   ///< Nearest deadline.
+    std::array<uint64_t, eEventsCount> m_deadlines;     ///< Deadline of each event.
+    std::array<EventHandler, eEventsCount> m_handlers;  ///< Handler of each event.
+};
+
+#endif /* SCHEDULER_H_ */
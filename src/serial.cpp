@@ -0,0 +1,110 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      serial.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "serial.h"
+
+Serial::Serial(Mmu& mmu, Scheduler& scheduler) :
+    m_mmu(mmu), m_scheduler(scheduler), m_sb(0), m_sc(0)
+{
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_sb,
+        [this]() -> uint8_t { return m_sb; },
+        [this](const uint8_t byte) { m_sb = byte; });
+
+    // The unused bits read as 1.
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_sc,
+        [this]() -> uint8_t { return 0x7E | m_sc; },
+        [this](const uint8_t byte) { writeControl(byte); });
+
+    m_scheduler.setHandler(SchedulerEvent::eSCHEDEVENT_serialtransfer,
+                           [this](const uint64_t /*deadline*/) { completeTransfer(); });
+}
+
+// =================================================================================================
+
+void Serial::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_serial, eStateVersion);
+
+    writer.write(m_sb);
+    writer.write(m_sc);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Serial::loadState(StateReader& reader)
+{
+    return (reader.openSection(savestate::eSECTION_serial) == true) && reader.read(m_sb) &&
+           reader.read(m_sc);
+}
+
+// =================================================================================================
+
+void Serial::writeControl(const uint8_t byte)
+{
+    const bool wasTransferring = (m_sc & eSC_start) != 0;
+    m_sc = byte & (eSC_start | eSC_internalclock);
+
+    if ((m_sc & eSC_start) == 0)
+    {
+        m_scheduler.cancel(SchedulerEvent::eSCHEDEVENT_serialtransfer);
+        return;
+    }
+
+    if (wasTransferring == false)
+    {
+        m_output.push_back(static_cast<char>(m_sb));
+    }
+
+    // Without a peer, only the console's own clock can shift the bits.
+    if ((m_sc & eSC_internalclock) != 0)
+    {
+        if (m_scheduler.isScheduled(SchedulerEvent::eSCHEDEVENT_serialtransfer) == false)
+        {
+            m_scheduler.schedule(SchedulerEvent::eSCHEDEVENT_serialtransfer,
+                                 m_scheduler.getNow() + eTransferClocks);
+        }
+    }
+    else
+    {
+        m_scheduler.cancel(SchedulerEvent::eSCHEDEVENT_serialtransfer);
+    }
+}
+
+// =================================================================================================
+
+void Serial::completeTransfer()
+{
+    m_sb = 0xFF;
+    m_sc &= static_cast<uint8_t>(~eSC_start);
+
+    const uint8_t interruptFlags = m_mmu.readByte(HardwareIORegisters::eIOREG_if);
+    m_mmu.writeByte(interruptFlags | InterruptFlags::eINTFLAG_serial,
+                    HardwareIORegisters::eIOREG_if);
+}
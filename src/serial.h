@@ -0,0 +1,100 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      serial.h
+///
+/// \brief     Emulation of the serial port, without any link cable.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SERIAL_H_
+#define SERIAL_H_
+
+#include "mmu.h"
+#include "savestate.h"
+#include "scheduler.h"
+
+#include <cstdint>
+#include <string>
+
+/// \brief Emulation of the serial registers (SB, SC) and of the serial interrupt.
+///
+/// No console is ever connected: a transfer on the internal clock shifts out SB in 8 bits of
+/// 512 clocks and shifts in 0xFF, a transfer waiting for an external clock never ends. The bytes
+/// sent are kept, test ROMs print their results this way.
+class Serial
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param mmu memory management unit routing the serial registers to the serial port.
+    /// \param scheduler master clock and events queue.
+    Serial(Mmu& mmu, Scheduler& scheduler);
+
+    Serial(const Serial&) = delete;
+    Serial& operator=(const Serial&) = delete;
+
+    /// \brief Get the bytes sent since the console was created or the output was cleared.
+    const std::string& getOutput() const { return m_output; }
+
+    /// \brief Forget the bytes sent.
+    void clearOutput() { m_output.clear(); }
+
+    /// \brief Write the serial state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the serial state, the end of the transfer is restored by the scheduler.
+    ///
+    /// \return true if the state holds the serial section, false otherwise.
+    bool loadState(StateReader& reader);
+
+private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    enum : uint8_t
+    {
+        eSC_start = 0x80,         ///< Transfer in progress.
+        eSC_internalclock = 0x01  ///< The console drives the clock.
+    };
+
+    enum : uint32_t
+    {
+        eTransferClocks = 8 * 512  ///< 8 bits at 8192 Hz.
+    };
+
+    /// \brief Write the serial transfer control register.
+    void writeControl(const uint8_t byte);
+
+    /// \brief End of a transfer: no peer answered, request the serial interrupt.
+    void completeTransfer();
+
+    Mmu& m_mmu;              ///< Memory management unit, holds the IF register.
+    Scheduler& m_scheduler;  ///< Master clock and events queue.
+
+    uint8_t m_sb;          ///< Serial transfer data.
+    uint8_t m_sc;          ///< Serial transfer control.
+    std::string m_output;  ///< Bytes sent.
+};
+
+#endif /* SERIAL_H_ */
@@ -0,0 +1,107 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      sharedframe.h
+///
+/// \brief     Layout of the shared memory segment where the completed frames are published.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SHAREDFRAME_H_
+#define SHAREDFRAME_H_
+
+// This header is shared with the out-of-process readers, it must stay free of any emulator
+// dependency.
+
+#include <atomic>
+#include <cstdint>
+
+namespace sharedframe
+{
+enum : uint32_t
+{
+    eMagic = 0x52464243,  ///< "CBFR" in memory.
+    eVersion = 2,         ///< Layout version, bumped on every incompatible change.
+    eSlotsCount = 3,      ///< Triple buffering.
+    eMaxDirtyLines = 256  ///< Lines covered by the dirty lines bitmap of a slot.
+};
+
+/// \brief Flags of a frame slot.
+enum SlotFlags : uint32_t
+{
+    eSLOTFLAG_dirtylines = 0x01  ///< The slot's dirty lines bitmap is valid.
+};
+
+/// \brief Header of one frame slot.
+///
+/// Seqlock: the writer makes the sequence odd while the slot is being rendered and even again
+/// once the frame is complete. A reader has read a full frame if the sequence was even and did
+/// not change between the start and the end of its read.
+///
+/// The dirty lines bitmap tells which lines differ from the previous frame (frameNumber - 1), a
+/// reader that did not draw that frame must redraw the whole slot.
+struct alignas(64) SlotHeader
+{
+    std::atomic<uint32_t> sequence;            ///< Seqlock counter, odd while the slot is written.
+    uint32_t flags;                            ///< SlotFlags values.
+    uint64_t frameNumber;                      ///< Number of the frame stored in this slot.
+    uint64_t dirtyLines[eMaxDirtyLines / 64];  ///< Bit n of word n / 64 set if line n changed.
+};
+
+/// \brief Header placed at the start of the segment, followed by the frame slots.
+struct alignas(64) SegmentHeader
+{
+    uint32_t magic;            ///< Always eMagic.
+    uint32_t version;          ///< Always eVersion.
+    uint32_t width;            ///< Frame width in pixels.
+    uint32_t height;           ///< Frame height in pixels.
+    uint32_t stride;           ///< Size in bytes of one frame line.
+    uint32_t pixelFormat;      ///< Value of the PixelFormat enum.
+    uint32_t slotsCount;       ///< Always eSlotsCount.
+    uint32_t slotSize;         ///< Size in bytes of one frame (stride * height).
+    uint64_t slotsOffset;      ///< Offset of the first frame from the start of the segment.
+    uint32_t dirtyLineHeight;  ///< Frame lines covered by one bit of the dirty lines bitmaps.
+    uint32_t reserved;
+
+    std::atomic<uint64_t> generation;  ///< Count of published frames, 0 if none yet.
+    std::atomic<uint32_t> latestSlot;  ///< Slot holding the newest complete frame.
+
+    SlotHeader slots[eSlotsCount];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared atomics must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared atomics must be lock free");
+
+/// \brief Get the pixels of a slot.
+///
+/// \param header mapped segment.
+/// \param slot slot index.
+///
+/// \return address of the slot's first pixel.
+inline const uint8_t* getSlotPixels(const SegmentHeader* header, const uint32_t slot)
+{
+    return reinterpret_cast<const uint8_t*>(header) + header->slotsOffset +
+           (static_cast<uint64_t>(slot) * header->slotSize);
+}
+
+}  // namespace sharedframe
+
+#endif /* SHAREDFRAME_H_ */
@@ -0,0 +1,86 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      sharedmetrics.h
+///
+/// \brief     Layout of the memory mapped metrics file written by the MetricsExporter.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef SHAREDMETRICS_H_
+#define SHAREDMETRICS_H_
+
+// This header is shared with the out-of-process readers, it must stay free of any emulator
+// dependency.
+
+#include <atomic>
+#include <cstdint>
+
+namespace sharedmetrics
+{
+enum : uint32_t
+{
+    eMagic = 0x544D4243,  ///< "CBMT" in memory.
+    eVersion = 1,         ///< Layout version, bumped on every incompatible change.
+    eMaxConsoles = 64,    ///< Console blocks in the file.
+    eNameSize = 48        ///< Size of a console's name, '\0' included.
+};
+
+/// \brief Metrics of one console.
+///
+/// Seqlock: the exporter makes the sequence odd while it updates the block and even again once
+/// done. A reader has read a consistent block if the sequence was even and did not change
+/// between the start and the end of its read.
+struct alignas(64) ConsoleBlock
+{
+    std::atomic<uint32_t> sequence;  ///< Seqlock counter, odd while the block is written.
+    uint32_t active;                 ///< 1 if the block holds a console, 0 otherwise.
+    char name[eNameSize];            ///< Console's name given to the exporter.
+    uint64_t emulatedClocks;         ///< Master clocks emulated, the run-ahead ones included.
+    uint64_t frames;                 ///< Frames run.
+    uint64_t instructions;           ///< CPU instructions executed.
+    uint64_t interrupts;             ///< Interrupts dispatched by the CPU.
+    uint64_t bankSwitches;           ///< VRAM and WRAM bank switches.
+    uint64_t haltedClocks;           ///< Master clocks spent with the CPU stopped.
+    uint64_t hostNs;                 ///< Wall time spent running frames.
+    uint64_t hostCPUNs;              ///< Host CPU time spent running frames.
+    uint64_t frameTimeP50Ns;         ///< Median wall time of a frame.
+    uint64_t frameTimeP99Ns;         ///< 99th percentile of the wall time of a frame.
+    double emulatedMHz;              ///< Emulation speed since the previous export.
+};
+
+/// \brief Content of the whole file.
+struct alignas(64) FileHeader
+{
+    uint32_t magic;                      ///< Always eMagic.
+    uint32_t version;                    ///< Always eVersion.
+    uint32_t maxConsoles;                ///< Always eMaxConsoles.
+    uint32_t blockSize;                  ///< Size of a ConsoleBlock.
+    std::atomic<uint64_t> exportsCount;  ///< Exports done, incremented after each one.
+
+    ConsoleBlock consoles[eMaxConsoles];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared atomics must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared atomics must be lock free");
+
+}  // namespace sharedmetrics
+
+#endif /* SHAREDMETRICS_H_ */
@@ -0,0 +1,127 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      threadpool.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "threadpool.h"
+
+ThreadPool::ThreadPool(const uint32_t threadsCount)
+{
+    m_threads.reserve(threadsCount);
+    for (uint32_t idx = 0; idx < threadsCount; ++idx)
+    {
+        m_threads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+// =================================================================================================
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+// =================================================================================================
+
+void ThreadPool::parallelFor(const uint32_t count, const std::function<void(const uint32_t)>& task)
+{
+    if ((m_threads.empty() == true) || (count < 2))
+    {
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            task(idx);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_nextIndex.store(0, std::memory_order_relaxed);
+        m_busyWorkers = getThreadsCount();
+        ++m_generation;
+    }
+    m_wakeUp.notify_all();
+
+    runTasks();
+
+    // Wait for every worker to leave the loop, so that none of them can pick up a task of the
+    // next loop with this loop's task function.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this]() { return m_busyWorkers == 0; });
+    m_task = nullptr;
+}
+
+// =================================================================================================
+
+void ThreadPool::workerLoop()
+{
+    uint64_t lastGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUp.wait(lock, [&]() {
+                return (m_stop == true) || (m_generation != lastGeneration);
+            });
+
+            if (m_stop == true)
+            {
+                return;
+            }
+
+            lastGeneration = m_generation;
+        }
+
+        runTasks();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busyWorkers == 0)
+        {
+            m_finished.notify_one();
+        }
+    }
+}
+
+// =================================================================================================
+
+void ThreadPool::runTasks()
+{
+    for (uint32_t idx = m_nextIndex.fetch_add(1); idx < m_count; idx = m_nextIndex.fetch_add(1))
+    {
+        (*m_task)(idx);
+    }
+}
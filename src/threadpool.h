@@ -0,0 +1,84 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      threadpool.h
+///
+/// \brief     Pool of worker threads running data parallel loops.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Pool of worker threads running data parallel loops.
+class ThreadPool
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param threadsCount number of worker threads, the caller of parallelFor is an extra one.
+    explicit ThreadPool(const uint32_t threadsCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// \brief Run a task for each index in [0, count) and wait for all of them to finish.
+    ///
+    /// The calling thread runs tasks too. Only one parallelFor may run at a time.
+    ///
+    /// \param count number of tasks.
+    /// \param task function called with the index of each task.
+    void parallelFor(const uint32_t count, const std::function<void(const uint32_t)>& task);
+
+    /// \brief Get the number of worker threads.
+    uint32_t getThreadsCount() const { return static_cast<uint32_t>(m_threads.size()); }
+
+private:
+    /// \brief Main loop of the worker threads.
+    void workerLoop();
+
+    /// \brief Run tasks of the current loop until none is left.
+    void runTasks();
+
+    std::vector<std::thread> m_threads;  ///< Worker threads.
+
+    std::mutex m_mutex;                  ///< Protects the loop's description.
+    std::condition_variable m_wakeUp;    ///< Signals a new loop to the workers.
+    std::condition_variable m_finished;  ///< Signals the end of the loop to the caller.
+
+    const std::function<void(const uint32_t)>* m_task = nullptr;  ///< Current loop's task.
+    uint32_t m_count = 0;                                         ///< Current loop's tasks count.
+    std::atomic<uint32_t> m_nextIndex{0};                         ///< Next task to run.
+    uint32_t m_busyWorkers = 0;  ///< Workers still taking part in the current loop.
+    uint64_t m_generation = 0;   ///< Number of the current loop.
+    bool m_stop = false;         ///< Are the workers asked to exit?
+};
+
+#endif /* THREADPOOL_H_ */
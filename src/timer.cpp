@@ -0,0 +1,195 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      timer.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "timer.h"
+
+#include <array>
+
+Timer::Timer(Mmu& mmu, Scheduler& scheduler) :
+    m_mmu(mmu), m_scheduler(scheduler), m_counterStart(scheduler.getNow()),
+    m_timaTime(scheduler.getNow()), m_tima(0), m_tma(0), m_tac(0)
+{
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_div,
+        [this]() -> uint8_t { return getCounter(m_scheduler.getNow()) >> 8; },
+        [this](const uint8_t byte) { writeRegister(HardwareIORegisters::eIOREG_div, byte); });
+
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_tima,
+        [this]() -> uint8_t {
+            updateTIMA(m_scheduler.getNow());
+            return m_tima;
+        },
+        [this](const uint8_t byte) { writeRegister(HardwareIORegisters::eIOREG_tima, byte); });
+
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_tma,
+        [this]() -> uint8_t { return m_tma; },
+        [this](const uint8_t byte) { writeRegister(HardwareIORegisters::eIOREG_tma, byte); });
+
+    m_mmu.setIOHandlers(
+        HardwareIORegisters::eIOREG_tac,
+        [this]() -> uint8_t { return 0xF8 | m_tac; },
+        [this](const uint8_t byte) { writeRegister(HardwareIORegisters::eIOREG_tac, byte); });
+
+    m_scheduler.setHandler(SchedulerEvent::eSCHEDEVENT_timeroverflow,
+                           [this](const uint64_t deadline) { overflow(deadline); });
+}
+
+// =================================================================================================
+
+void Timer::setCounter(const uint16_t counter)
+{
+    const uint64_t now = m_scheduler.getNow();
+    updateTIMA(now);
+
+    // The origin may precede the clock 0: the differences with it wrap back to the counter.
+    m_counterStart = now - counter;
+
+    scheduleOverflow();
+}
+
+// =================================================================================================
+
+void Timer::saveState(StateWriter& writer) const
+{
+    writer.beginSection(savestate::eSECTION_timer, eStateVersion);
+
+    writer.write(m_counterStart);
+    writer.write(m_timaTime);
+    writer.write(m_tima);
+    writer.write(m_tma);
+    writer.write(m_tac);
+
+    writer.endSection();
+}
+
+// =================================================================================================
+
+bool Timer::loadState(StateReader& reader)
+{
+    return (reader.openSection(savestate::eSECTION_timer) == true) &&
+           reader.read(m_counterStart) && reader.read(m_timaTime) && reader.read(m_tima) &&
+           reader.read(m_tma) && reader.read(m_tac);
+}
+
+// =================================================================================================
+
+uint64_t Timer::countIncrements(const uint64_t from, const uint64_t to) const
+{
+    // TIMA is incremented each time the counter reaches a multiple of the period.
+    const uint32_t period = getPeriod();
+
+    return ((to - m_counterStart) / period) - ((from - m_counterStart) / period);
+}
+
+// =================================================================================================
+
+void Timer::updateTIMA(const uint64_t time)
+{
+    if (isEnabled() == true)
+    {
+        // The overflow event keeps TIMA under 256 until then.
+        m_tima = static_cast<uint8_t>(m_tima + countIncrements(m_timaTime, time));
+    }
+
+    m_timaTime = time;
+}
+
+// =================================================================================================
+
+void Timer::scheduleOverflow()
+{
+    if (isEnabled() == false)
+    {
+        m_scheduler.cancel(SchedulerEvent::eSCHEDEVENT_timeroverflow);
+        return;
+    }
+
+    // The overflow happens on the (256 - TIMA)th multiple of the period after m_timaTime.
+    const uint64_t period = getPeriod();
+    const uint64_t counter = m_timaTime - m_counterStart;
+    const uint64_t firstIncrement = ((counter / period) + 1) * period;
+    const uint64_t deadline = m_counterStart + firstIncrement + ((255 - m_tima) * period);
+
+    m_scheduler.schedule(SchedulerEvent::eSCHEDEVENT_timeroverflow, deadline);
+}
+
+// =================================================================================================
+
+void Timer::overflow(const uint64_t deadline)
+{
+    m_tima = m_tma;
+    m_timaTime = deadline;
+
+    m_mmu.writeByte(m_mmu.readByte(HardwareIORegisters::eIOREG_if) | InterruptFlags::eINTFLAG_timer,
+                    HardwareIORegisters::eIOREG_if);
+
+    scheduleOverflow();
+}
+
+// =================================================================================================
+
+uint32_t Timer::getPeriod() const
+{
+    // 4096 Hz, 262144 Hz, 65536 Hz and 16384 Hz.
+    static constexpr std::array<uint32_t, 4> periods = {1024, 16, 64, 256};
+
+    return periods[m_tac & 0x03];
+}
+
+// =================================================================================================
+
+void Timer::writeRegister(const uint16_t address, const uint8_t byte)
+{
+    const uint64_t now = m_scheduler.getNow();
+    updateTIMA(now);
+
+    switch (address)
+    {
+    case HardwareIORegisters::eIOREG_div:
+        // Resetting the counter while the watched bit is set is a falling edge: TIMA ticks.
+        if ((isEnabled() == true) && ((getCounter(now) & (getPeriod() / 2)) != 0))
+        {
+            if (m_tima == 0xFF)
+            {
+                overflow(now);
+            }
+            else
+            {
+                ++m_tima;
+            }
+        }
+        m_counterStart = now;
+        break;
+
+    case HardwareIORegisters::eIOREG_tima: m_tima = byte; break;
+    case HardwareIORegisters::eIOREG_tma: m_tma = byte; break;
+    case HardwareIORegisters::eIOREG_tac: m_tac = byte & 0x07; break;
+    }
+
+    scheduleOverflow();
+}
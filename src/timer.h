@@ -0,0 +1,110 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      timer.h
+///
+/// \brief     Emulation of the Game Boy's divider and programmable timer.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include "mmu.h"
+#include "scheduler.h"
+
+#include <cstdint>
+
+/// \brief Emulation of the Game Boy's divider (DIV) and programmable timer (TIMA/TMA/TAC).
+///
+/// Nothing is counted on each clock. DIV is the high byte of a 16 bits counter derived from the
+/// master clock on demand. TIMA is brought up to date when it is accessed, and the clock of its
+/// next overflow is computed from the counter and scheduled as a single event, which reloads
+/// TMA and requests the timer interrupt.
+class Timer
+{
+public:
+    /// \brief Constructor.
+    ///
+    /// \param mmu memory management unit routing the timer registers to the timer.
+    /// \param scheduler master clock and events queue.
+    Timer(Mmu& mmu, Scheduler& scheduler);
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    /// \brief Set the internal counter, e.g. to the value left by a skipped boot ROM.
+    ///
+    /// \param counter value of the 16 bits counter from now on, DIV is its high byte.
+    void setCounter(const uint16_t counter);
+
+    /// \brief Write the timer state.
+    void saveState(StateWriter& writer) const;
+
+    /// \brief Read back the timer state, its overflow deadline is restored by the scheduler.
+    ///
+    /// \return true if the state holds the timer section, false otherwise.
+    bool loadState(StateReader& reader);
+
+private:
+    enum : uint16_t
+    {
+        eStateVersion = 1  ///< Version of the state section.
+    };
+
+    /// \brief Get the internal 16 bits counter (DIV is its high byte) at a master clock value.
+    uint16_t getCounter(const uint64_t time) const
+    {
+        return static_cast<uint16_t>(time - m_counterStart);
+    }
+
+    /// \brief Get the number of TIMA increments between two master clock values.
+    uint64_t countIncrements(const uint64_t from, const uint64_t to) const;
+
+    /// \brief Bring TIMA up to date with a master clock value.
+    void updateTIMA(const uint64_t time);
+
+    /// \brief Schedule the next TIMA overflow, or cancel it if the timer is stopped.
+    void scheduleOverflow();
+
+    /// \brief TIMA overflow: reload TMA and request the timer interrupt.
+    void overflow(const uint64_t deadline);
+
+    /// \brief Check if TIMA is counting.
+    bool isEnabled() const { return (m_tac & 0x04) != 0; }
+
+    /// \brief Get the clocks between two TIMA increments.
+    uint32_t getPeriod() const;
+
+    /// \brief Write a timer register.
+    void writeRegister(const uint16_t address, const uint8_t byte);
+
+    Mmu& m_mmu;              ///< Memory management unit, holds the IF register.
+    Scheduler& m_scheduler;  ///< Master clock and events queue.
+
+    uint64_t m_counterStart;  ///< Master clock at which the internal counter was 0.
+    uint64_t m_timaTime;      ///< Master clock at which m_tima was up to date.
+    uint8_t m_tima;           ///< Timer counter.
+    uint8_t m_tma;            ///< Timer modulo.
+    uint8_t m_tac;            ///< Timer control.
+};
+
+#endif /* TIMER_H_ */
@@ -0,0 +1,162 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      tracewriter.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "tracewriter.h"
+
+namespace
+{
+/// \brief Blocks queued before the emulation thread waits for the writer thread.
+constexpr size_t eMaxQueuedBlocks = 8;
+
+}  // namespace
+
+TraceWriter::~TraceWriter() { close(); }
+
+// =================================================================================================
+
+bool TraceWriter::open(const std::filesystem::path& path)
+{
+    close();
+
+    m_file = std::fopen(path.string().c_str(), "wb");
+    if (m_file == nullptr)
+    {
+        return false;
+    }
+
+    const cputrace::FileHeader header = {cputrace::eMagic, cputrace::eVersion,
+                                         cputrace::eEncodedRecordSize, 0};
+    if (std::fwrite(&header, sizeof(header), 1, m_file) != 1)
+    {
+        std::fclose(m_file);
+        m_file = nullptr;
+
+        return false;
+    }
+
+    m_block.clear();
+    m_block.reserve(cputrace::eBlockRecords);
+    m_recordsCount = 0;
+    m_stop = false;
+    m_failed = false;
+    m_thread = std::thread(&TraceWriter::writeLoop, this);
+
+    return true;
+}
+
+// =================================================================================================
+
+bool TraceWriter::close()
+{
+    if (m_file == nullptr)
+    {
+        return true;
+    }
+
+    if (m_block.empty() == false)
+    {
+        flushBlock();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+
+    const bool closed = (std::fclose(m_file) == 0);
+    m_file = nullptr;
+    m_queue.clear();
+    m_free.clear();
+
+    return (closed == true) && (m_failed == false);
+}
+
+// =================================================================================================
+
+void TraceWriter::flushBlock()
+{
+    m_recordsCount += m_block.size();
+
+    std::vector<cputrace::Record> nextBlock;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Never run more than a few blocks ahead of the disk.
+        m_blockFreed.wait(lock, [this] { return m_queue.size() < eMaxQueuedBlocks; });
+
+        m_queue.push_back(std::move(m_block));
+        if (m_free.empty() == false)
+        {
+            nextBlock = std::move(m_free.back());
+            m_free.pop_back();
+        }
+    }
+    m_wakeUp.notify_one();
+
+    m_block = std::move(nextBlock);
+    m_block.clear();
+    m_block.reserve(cputrace::eBlockRecords);
+}
+
+// =================================================================================================
+
+void TraceWriter::writeLoop()
+{
+    std::vector<uint8_t> compressed;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wakeUp.wait(lock, [this] { return (m_stop == true) || (m_queue.empty() == false); });
+        if (m_queue.empty() == true)
+        {
+            return;
+        }
+
+        std::vector<cputrace::Record> block = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+
+        // A block is split where the cycles jump.
+        bool written = true;
+        const uint32_t count = static_cast<uint32_t>(block.size());
+        for (uint32_t first = 0; first < count;)
+        {
+            cputrace::BlockHeader header;
+            first += cputrace::encodeBlock(&block[first], count - first, header, compressed);
+
+            written = (written == true) &&
+                      (std::fwrite(&header, sizeof(header), 1, m_file) == 1) &&
+                      (std::fwrite(compressed.data(), 1, compressed.size(), m_file) ==
+                       compressed.size());
+        }
+
+        lock.lock();
+        m_failed = (m_failed == true) || (written == false);
+        m_free.push_back(std::move(block));
+        m_blockFreed.notify_one();
+    }
+}
@@ -0,0 +1,103 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      tracewriter.h
+///
+/// \brief     Writer of the binary CPU instruction traces.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef TRACEWRITER_H_
+#define TRACEWRITER_H_
+
+#include "cputrace.h"
+#include "instructiontracer.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Records the CPU state of each instruction into a cputrace file.
+///
+/// The records are appended to a block buffer on the emulation thread. Full blocks are handed to
+/// a background thread which compresses and writes them.
+class TraceWriter : public InstructionTracer
+{
+public:
+    TraceWriter() = default;
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /// \brief Create the trace file and start the writer thread.
+    ///
+    /// \param path trace file path.
+    ///
+    /// \return true if the file was created, false otherwise.
+    bool open(const std::filesystem::path& path);
+
+    /// \brief Write the last records and close the file.
+    ///
+    /// \return true if every record was written, false on a write error.
+    bool close();
+
+    /// \brief Is the trace file open?
+    bool isOpen() const { return m_file != nullptr; }
+
+    /// \brief Append an instruction's record.
+    void traceInstruction(const cputrace::Record& record) override
+    {
+        m_block.push_back(record);
+        if (m_block.size() == cputrace::eBlockRecords)
+        {
+            flushBlock();
+        }
+    }
+
+    /// \brief Get the number of records appended since open().
+    uint64_t getRecordsCount() const { return m_recordsCount + m_block.size(); }
+
+private:
+    /// \brief Hand the current block to the writer thread.
+    void flushBlock();
+
+    /// \brief Main loop of the writer thread.
+    void writeLoop();
+
+    FILE* m_file = nullptr;                 ///< Trace file.
+    std::vector<cputrace::Record> m_block;  ///< Block being filled.
+    uint64_t m_recordsCount = 0;            ///< Records of the blocks handed to the thread.
+
+    std::mutex m_mutex;                                 ///< Protects the queues and the flags.
+    std::condition_variable m_wakeUp;                   ///< Signals a queued block or the stop.
+    std::condition_variable m_blockFreed;               ///< Signals a freed block.
+    std::deque<std::vector<cputrace::Record>> m_queue;  ///< Blocks waiting to be written.
+    std::vector<std::vector<cputrace::Record>> m_free;  ///< Written blocks, for reuse.
+    bool m_stop = false;                                ///< Is the writer thread asked to stop?
+    bool m_failed = false;                              ///< Did a write fail?
+    std::thread m_thread;                               ///< Writer thread.
+};
+
+#endif /* TRACEWRITER_H_ */
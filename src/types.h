@@ -69,16 +69,74 @@ enum HardwareIORegisters : uint16_t
 {
     eIOREG_scrolly = 0xFF42,
     eIOREG_scrollx,
+    eIOREG_p1 = 0xFF00,    ///< Joypad (R/W).
+    eIOREG_sb = 0xFF01,    ///< Serial transfer data (R/W).
+    eIOREG_sc = 0xFF02,    ///< Serial transfer control (R/W).
+    eIOREG_div = 0xFF04,   ///< Divider Register (R/W).
+    eIOREG_tima = 0xFF05,  ///< Timer Counter (R/W).
+    eIOREG_tma = 0xFF06,   ///< Timer Modulo (R/W).
+    eIOREG_tac = 0xFF07,   ///< Timer Control (R/W).
     eIOREG_if = 0xFF0F,    ///< Interrupt Flags (R/W).
+    eIOREG_nr10 = 0xFF10,  ///< Channel 1 Sweep (R/W).
+    eIOREG_nr11 = 0xFF11,  ///< Channel 1 Duty and Length (R/W).
+    eIOREG_nr12 = 0xFF12,  ///< Channel 1 Volume Envelope (R/W).
+    eIOREG_nr13 = 0xFF13,  ///< Channel 1 Frequency Low (W).
+    eIOREG_nr14 = 0xFF14,  ///< Channel 1 Frequency High and Trigger (R/W).
+    eIOREG_nr21 = 0xFF16,  ///< Channel 2 Duty and Length (R/W).
+    eIOREG_nr22 = 0xFF17,  ///< Channel 2 Volume Envelope (R/W).
+    eIOREG_nr23 = 0xFF18,  ///< Channel 2 Frequency Low (W).
+    eIOREG_nr24 = 0xFF19,  ///< Channel 2 Frequency High and Trigger (R/W).
+    eIOREG_nr30 = 0xFF1A,  ///< Channel 3 DAC Power (R/W).
+    eIOREG_nr31 = 0xFF1B,  ///< Channel 3 Length (W).
+    eIOREG_nr32 = 0xFF1C,  ///< Channel 3 Output Level (R/W).
+    eIOREG_nr33 = 0xFF1D,  ///< Channel 3 Frequency Low (W).
+    eIOREG_nr34 = 0xFF1E,  ///< Channel 3 Frequency High and Trigger (R/W).
+    eIOREG_nr41 = 0xFF20,  ///< Channel 4 Length (W).
+    eIOREG_nr42 = 0xFF21,  ///< Channel 4 Volume Envelope (R/W).
+    eIOREG_nr43 = 0xFF22,  ///< Channel 4 Polynomial Counter (R/W).
+    eIOREG_nr44 = 0xFF23,  ///< Channel 4 Trigger (R/W).
+    eIOREG_nr50 = 0xFF24,  ///< Master Volume (R/W).
+    eIOREG_nr51 = 0xFF25,  ///< Sound Panning (R/W).
+    eIOREG_nr52 = 0xFF26,  ///< Sound On/Off and Channels Status (R/W).
+    eIOREG_wavestart = 0xFF30,  ///< Start of the Wave Pattern RAM (R/W).
+    eIOREG_waveend = 0xFF3F,    ///< End of the Wave Pattern RAM (R/W).
     eIOREG_lcdc = 0xFF40,  ///< LCD Control (R/W).
     eIOREG_stat = 0xFF41,  ///< LCD Status (R/W).
     eIOREG_scy = 0xFF42,   ///< BG Scroll Y (R/W).
     eIOREG_scx = 0xFF43,   ///< BG Scroll X (R/W).
     eIOREG_ly = 0xFF44,    ///< LCD Current Scanline (R).
     eIOREG_lyc = 0xFF45,   ///< LY Compare (R/W).
+    eIOREG_bgp = 0xFF47,   ///< BG Palette Data (R/W) - Non CGB Mode Only.
+    eIOREG_obp0 = 0xFF48,  ///< Object Palette 0 Data (R/W) - Non CGB Mode Only.
+    eIOREG_obp1 = 0xFF49,  ///< Object Palette 1 Data (R/W) - Non CGB Mode Only.
     eIOREG_wy = 0xFF4A,    ///< Window Y Position (R/W).
     eIOREG_wx = 0xFF4B,    ///< Window X Position (R/W).
-    eIOREG_romswitch = 0xFF50
+    eIOREG_vbk = 0xFF4F,   ///< VRAM Bank (R/W) - CGB Mode Only.
+    eIOREG_romswitch = 0xFF50,
+    eIOREG_bcps = 0xFF68,  ///< Background Palette Index (R/W) - CGB Mode Only.
+    eIOREG_bcpd = 0xFF69,  ///< Background Palette Data (R/W) - CGB Mode Only.
+    eIOREG_ocps = 0xFF6A,  ///< Sprite Palette Index (R/W) - CGB Mode Only.
+    eIOREG_ocpd = 0xFF6B,  ///< Sprite Palette Data (R/W) - CGB Mode Only.
+    eIOREG_svbk = 0xFF70   ///< WRAM Bank (R/W) - CGB Mode Only.
+};
+
+/// \brief Bits of the LCD Control register (LCDC).
+enum LCDControlBits : uint8_t
+{
+    eLCDC_bgenable = 0x01,       ///< BG/Window display.
+    eLCDC_objenable = 0x02,      ///< Sprites display.
+    eLCDC_objsize = 0x04,        ///< Sprites size (0 = 8x8, 1 = 8x16).
+    eLCDC_bgtilemap = 0x08,      ///< BG tile map (0 = 9800-9BFF, 1 = 9C00-9FFF).
+    eLCDC_tiledata = 0x10,       ///< BG/Window tile data (0 = 8800-97FF, 1 = 8000-8FFF).
+    eLCDC_windowenable = 0x20,   ///< Window display.
+    eLCDC_windowtilemap = 0x40,  ///< Window tile map (0 = 9800-9BFF, 1 = 9C00-9FFF).
+    eLCDC_lcdenable = 0x80       ///< LCD display.
+};
+
+/// \brief Layouts of the pixels produced by the PPU.
+enum class PixelFormat : uint8_t
+{
+    ePIXFMT_rgba8888  ///< 32-bit pixels, bytes stored in R, G, B, A order.
 };
 
 /// \brief Adresses of the Game Boy's interrupts.
@@ -91,6 +149,16 @@ enum InterruptAddresses : uint16_t
     eINTADDR_joypad = 0x0060    ///< Joypad interrupt.
 };
 
+/// \brief Bits of the interrupts in the IF and IE registers.
+enum InterruptFlags : uint8_t
+{
+    eINTFLAG_vblank = 0x01,   ///< V-Blank interrupt.
+    eINTFLAG_lcdstat = 0x02,  ///< LCD STAT interrupt.
+    eINTFLAG_timer = 0x04,    ///< Timer interrupt.
+    eINTFLAG_serial = 0x08,   ///< Serial interrupt.
+    eINTFLAG_joypad = 0x10    ///< Joypad interrupt.
+};
+
 /// \brief LCD's periods timing in number of clock cycles.
 enum LCDTiming : uint16_t
 {
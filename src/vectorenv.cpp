@@ -0,0 +1,360 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      vectorenv.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "vectorenv.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/// \brief Skip the spaces of an expression.
+void skipSpaces(const std::string& expression, size_t& pos)
+{
+    while ((pos < expression.size()) && (expression[pos] == ' '))
+    {
+        ++pos;
+    }
+}
+
+/// \brief Skip a token if the expression continues with it.
+///
+/// \return true if the token was skipped, false otherwise.
+bool acceptToken(const std::string& expression, size_t& pos, const char* token)
+{
+    skipSpaces(expression, pos);
+
+    const size_t length = std::strlen(token);
+    if (expression.compare(pos, length, token) != 0)
+    {
+        return false;
+    }
+
+    pos += length;
+
+    return true;
+}
+
+/// \brief Parse a value of a reward term: u8[ADDRESS], u16[ADDRESS] or delta(VALUE).
+bool parseRewardValue(const std::string& expression, size_t& pos, RewardTerm& term)
+{
+    if (acceptToken(expression, pos, "delta(") == true)
+    {
+        term.delta = true;
+
+        return (parseRewardValue(expression, pos, term) == true) &&
+               (acceptToken(expression, pos, ")") == true);
+    }
+
+    if (acceptToken(expression, pos, "u16[") == true)
+    {
+        term.word = true;
+    }
+    else if (acceptToken(expression, pos, "u8[") == false)
+    {
+        return false;
+    }
+
+    skipSpaces(expression, pos);
+    const char* start = expression.c_str() + pos;
+    char* end = nullptr;
+    const unsigned long address = std::strtoul(start, &end, 16);
+    if ((end == start) || (address > 0xFFFF))
+    {
+        return false;
+    }
+
+    term.address = static_cast<uint16_t>(address);
+    pos += end - start;
+
+    return acceptToken(expression, pos, "]");
+}
+
+}  // namespace
+
+bool parseRewardExpression(const std::string& expression, std::vector<RewardTerm>& terms)
+{
+    terms.clear();
+
+    size_t pos = 0;
+    float sign = (acceptToken(expression, pos, "-") == true) ? -1.0f : 1.0f;
+    while (true)
+    {
+        RewardTerm term;
+        term.weight = sign;
+
+        // The weight is optional.
+        skipSpaces(expression, pos);
+        const char* start = expression.c_str() + pos;
+        char* end = nullptr;
+        const float weight = std::strtof(start, &end);
+        if (end != start)
+        {
+            pos += end - start;
+            if (acceptToken(expression, pos, "*") == false)
+            {
+                return false;
+            }
+
+            term.weight *= weight;
+        }
+
+        if (parseRewardValue(expression, pos, term) == false)
+        {
+            return false;
+        }
+        terms.push_back(term);
+
+        skipSpaces(expression, pos);
+        if (pos == expression.size())
+        {
+            return true;
+        }
+
+        if (acceptToken(expression, pos, "+") == true)
+        {
+            sign = 1.0f;
+        }
+        else if (acceptToken(expression, pos, "-") == true)
+        {
+            sign = -1.0f;
+        }
+        else
+        {
+            return false;
+        }
+    }
+}
+
+// =================================================================================================
+
+VectorEnv::VectorEnv(const GBType type, std::vector<uint8_t> rom, const VectorEnvConfig& config) :
+    m_config(config), m_threadPool(config.threadsCount), m_observationSize(0), m_actions(nullptr),
+    m_frameskip(0)
+{
+    CBASSERT(m_config.envsCount > 0, "A VectorEnv needs a console");
+    CBASSERT((m_config.screenScale > 0) && ((Ppu::eFrameWidth % m_config.screenScale) == 0) &&
+                 ((Ppu::eFrameHeight % m_config.screenScale) == 0),
+             "Invalid screen downsampling");
+
+    // The first console runs to the start state, the others are its clones and share its ROM.
+    m_consoles.reserve(m_config.envsCount);
+    m_consoles.push_back(std::make_unique<Console>(type, std::move(rom)));
+
+    Console& first = *m_consoles.front();
+    first.setAudioMode(ApuMode::eAPUMODE_statusonly);
+    first.powerOn(m_config.bootMode);
+    for (uint32_t frame = 0; frame < m_config.startFrames; ++frame)
+    {
+        first.runFrame();
+    }
+
+    for (uint32_t envIdx = 1; envIdx < m_config.envsCount; ++envIdx)
+    {
+        m_consoles.push_back(first.clone());
+        m_consoles.back()->setAudioMode(ApuMode::eAPUMODE_statusonly);
+    }
+
+    m_startState.resize(first.getStateSize());
+    first.saveState(m_startState.data(), m_startState.size());
+
+    m_observationSize =
+        (m_config.observation == Observation::eOBSERVATION_screen)
+            ? (Ppu::eFrameWidth / m_config.screenScale) * (Ppu::eFrameHeight / m_config.screenScale)
+            : m_config.ramAddresses.size();
+    m_observations.resize(m_observationSize * m_config.envsCount);
+    m_rewards.resize(m_config.envsCount);
+
+    // The consoles' frames are not part of the state, the resets copy the start one.
+    m_startObservation.resize(m_observationSize);
+    observe(first, m_startObservation.data());
+
+    m_stepTask = [this](const uint32_t envIdx) { stepEnv(envIdx); };
+
+    reset();
+}
+
+// =================================================================================================
+
+bool VectorEnv::setReward(const std::string& expression)
+{
+    std::vector<RewardTerm> terms;
+    if ((expression.empty() == false) && (parseRewardExpression(expression, terms) == false))
+    {
+        return false;
+    }
+
+    m_rewardTerms = std::move(terms);
+    m_rewardValues.assign(m_rewardTerms.size() * getEnvsCount(), 0);
+
+    // The deltas start from the current values.
+    for (uint32_t envIdx = 0; envIdx < getEnvsCount(); ++envIdx)
+    {
+        computeReward(envIdx);
+        m_rewards[envIdx] = 0.0f;
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+bool VectorEnv::setStartState(const Console& source)
+{
+    // A state the consoles cannot load leaves them untouched.
+    std::vector<uint8_t> state(source.getStateSize());
+    if ((source.saveState(state.data(), state.size()) == 0) ||
+        (m_consoles.front()->loadState(state.data(), state.size()) == false))
+    {
+        return false;
+    }
+
+    m_startState = std::move(state);
+    observe(source, m_startObservation.data());
+    reset();
+
+    return true;
+}
+
+// =================================================================================================
+
+void VectorEnv::reset()
+{
+    for (uint32_t envIdx = 0; envIdx < getEnvsCount(); ++envIdx)
+    {
+        reset(envIdx);
+    }
+}
+
+// =================================================================================================
+
+void VectorEnv::reset(const uint32_t envIdx)
+{
+    Console& console = *m_consoles[envIdx];
+    console.loadState(m_startState.data(), m_startState.size());
+
+    std::copy(m_startObservation.begin(),
+              m_startObservation.end(),
+              m_observations.begin() + (envIdx * m_observationSize));
+    computeReward(envIdx);
+    m_rewards[envIdx] = 0.0f;
+}
+
+// =================================================================================================
+
+void VectorEnv::step(const uint8_t* actions, const uint32_t frameskip)
+{
+    m_actions = actions;
+    m_frameskip = frameskip;
+
+    m_threadPool.parallelFor(getEnvsCount(), m_stepTask);
+}
+
+// =================================================================================================
+
+void VectorEnv::stepEnv(const uint32_t envIdx)
+{
+    Console& console = *m_consoles[envIdx];
+    console.setJoypadButtons(m_actions[envIdx]);
+    for (uint32_t frame = 0; frame < m_frameskip; ++frame)
+    {
+        console.runFrame();
+    }
+
+    observe(console, m_observations.data() + (envIdx * m_observationSize));
+    m_rewards[envIdx] = computeReward(envIdx);
+}
+
+// =================================================================================================
+
+void VectorEnv::observe(const Console& console, uint8_t* observation) const
+{
+    if (m_config.observation == Observation::eOBSERVATION_ram)
+    {
+        for (const uint16_t address : m_config.ramAddresses)
+        {
+            *observation++ = console.readMemory(address);
+        }
+
+        return;
+    }
+
+    // Luma of the R, G, B bytes with the BT.601 weights in 1/256, averaged over each block.
+    const uint8_t* pixels = reinterpret_cast<const uint8_t*>(console.getFrameBuffer());
+    const uint32_t scale = m_config.screenScale;
+    const uint32_t blockWeight = scale * scale * 256;
+    for (uint32_t y = 0; y < Ppu::eFrameHeight; y += scale)
+    {
+        for (uint32_t x = 0; x < Ppu::eFrameWidth; x += scale)
+        {
+            uint32_t sum = 0;
+            for (uint32_t blockY = 0; blockY < scale; ++blockY)
+            {
+                const uint8_t* pixel = pixels + ((((y + blockY) * Ppu::eFrameWidth) + x) * 4);
+                for (uint32_t blockX = 0; blockX < scale; ++blockX, pixel += 4)
+                {
+                    sum += (77 * pixel[0]) + (150 * pixel[1]) + (29 * pixel[2]);
+                }
+            }
+
+            *observation++ = static_cast<uint8_t>(sum / blockWeight);
+        }
+    }
+}
+
+// =================================================================================================
+
+int32_t VectorEnv::readRewardValue(const Console& console, const RewardTerm& term)
+{
+    if (term.word == true)
+    {
+        return console.readMemory(term.address) |
+               (console.readMemory(static_cast<uint16_t>(term.address + 1)) << 8);
+    }
+
+    return console.readMemory(term.address);
+}
+
+// =================================================================================================
+
+float VectorEnv::computeReward(const uint32_t envIdx)
+{
+    const Console& console = *m_consoles[envIdx];
+    int32_t* values = m_rewardValues.data() + (envIdx * m_rewardTerms.size());
+
+    float reward = 0.0f;
+    for (size_t termIdx = 0; termIdx < m_rewardTerms.size(); ++termIdx)
+    {
+        const RewardTerm& term = m_rewardTerms[termIdx];
+        const int32_t value = readRewardValue(console, term);
+
+        reward += term.weight * ((term.delta == true) ? (value - values[termIdx]) : value);
+        values[termIdx] = value;
+    }
+
+    return reward;
+}
@@ -0,0 +1,180 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      vectorenv.h
+///
+/// \brief     Batch of consoles stepped together, for reinforcement learning agents.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef VECTORENV_H_
+#define VECTORENV_H_
+
+#include "console.h"
+#include "threadpool.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// \brief What the agents observe after each step.
+enum class Observation : uint8_t
+{
+    eOBSERVATION_screen,  ///< Downsampled grayscale screen, one byte per pixel.
+    eOBSERVATION_ram      ///< Selected bytes of the memory.
+};
+
+/// \brief Configuration of a VectorEnv.
+struct VectorEnvConfig
+{
+    uint32_t envsCount = 1;                ///< Number of consoles.
+    /// Worker threads besides the caller of step(), one per other hardware thread by default.
+    uint32_t threadsCount = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    Observation observation = Observation::eOBSERVATION_screen;  ///< What is observed.
+    uint32_t screenScale = 2;              ///< Screen downsampling, divides 160 and 144.
+    std::vector<uint16_t> ramAddresses;    ///< Bytes observed with eOBSERVATION_ram.
+    uint32_t startFrames = 0;              ///< Frames run after power on, before the start state.
+    BootMode bootMode = BootMode::eBOOTMODE_bootROM;  ///< How the consoles are powered on.
+};
+
+/// \brief A term of a reward expression.
+struct RewardTerm
+{
+    uint16_t address = 0;  ///< Address of the value.
+    bool word = false;     ///< Is the value a little endian word rather than a byte?
+    bool delta = false;    ///< Is the change of the value since the previous step rewarded?
+    float weight = 1.0f;   ///< Factor of the value.
+};
+
+// =================================================================================================
+//   Reward expressions:
+//
+// expression := term { ('+' | '-') term }
+// term       := [number '*'] value
+// value      := 'u8[' address ']' | 'u16[' address ']' | 'delta(' value ')'
+// address    := hexadecimal number, 0x prefixed or not
+//
+//   delta(u16[0xD347]) - 0.01*u8[0xD057]
+// =================================================================================================
+
+/// \brief Parse a reward expression.
+///
+/// \param expression the expression.
+/// \param[out] terms receives the expression's terms.
+///
+/// \return true if the expression is valid, false otherwise.
+bool parseRewardExpression(const std::string& expression, std::vector<RewardTerm>& terms);
+
+/// \brief Consoles running the same game, stepped together on a thread pool.
+///
+/// Each step() applies one action per console, runs them in parallel, then writes their
+/// observations into one contiguous batch and their rewards into another. The batches are
+/// allocated once, a step allocates nothing.
+class VectorEnv
+{
+public:
+    /// \brief Constructor, the consoles are reset to the start state.
+    ///
+    /// \param type Game Boy's type to emulate.
+    /// \param rom content of the game ROM, shared by the consoles.
+    /// \param config configuration of the batch.
+    VectorEnv(const GBType type, std::vector<uint8_t> rom, const VectorEnvConfig& config);
+
+    /// \brief Select the reward of the steps, no reward by default.
+    ///
+    /// \param expression reward expression, see parseRewardExpression().
+    ///
+    /// \return true if the expression is valid, false otherwise.
+    bool setReward(const std::string& expression);
+
+    /// \brief Replace the start state, e.g. by the state of a console at the beginning of a level.
+    ///
+    /// The screen is not part of the states: the resets observe the source's current screen.
+    ///
+    /// \param source a console of the same type running the same game, may be one of the batch.
+    ///
+    /// \return true if the state can be loaded by the consoles, false otherwise.
+    bool setStartState(const Console& source);
+
+    /// \brief Bring every console back to the start state and observe it.
+    void reset();
+
+    /// \brief Bring a console back to the start state and observe it, e.g. after a game over.
+    void reset(const uint32_t envIdx);
+
+    /// \brief Run every console for some frames.
+    ///
+    /// \param actions JoypadButtons mask of each console, held during the whole step.
+    /// \param frameskip frames run per step, only the last one is observed.
+    void step(const uint8_t* actions, const uint32_t frameskip);
+
+    /// \brief Get the observations of the last step: getEnvsCount() x getObservationSize().
+    const uint8_t* getObservations() const { return m_observations.data(); }
+
+    /// \brief Get the size of one console's observation in bytes.
+    size_t getObservationSize() const { return m_observationSize; }
+
+    /// \brief Get the rewards of the last step, one per console.
+    const float* getRewards() const { return m_rewards.data(); }
+
+    /// \brief Get the number of consoles.
+    uint32_t getEnvsCount() const { return static_cast<uint32_t>(m_consoles.size()); }
+
+    /// \brief Get a console, e.g. to read its memory or save its state.
+    Console& getConsole(const uint32_t envIdx) { return *m_consoles[envIdx]; }
+
+private:
+    /// \brief Run a console for the current step and observe it.
+    void stepEnv(const uint32_t envIdx);
+
+    /// \brief Observe a console.
+    ///
+    /// \param console the observed console.
+    /// \param[out] observation receives getObservationSize() bytes.
+    void observe(const Console& console, uint8_t* observation) const;
+
+    /// \brief Read the value of a reward term.
+    static int32_t readRewardValue(const Console& console, const RewardTerm& term);
+
+    /// \brief Compute a console's reward and remember the values of its delta terms.
+    float computeReward(const uint32_t envIdx);
+
+    VectorEnvConfig m_config;                          ///< Configuration of the batch.
+    std::vector<std::unique_ptr<Console>> m_consoles;  ///< The consoles.
+    std::vector<uint8_t> m_startState;                 ///< State restored by reset().
+    std::vector<uint8_t> m_startObservation;           ///< Observation of the start state.
+    ThreadPool m_threadPool;                           ///< Runs the consoles.
+
+    std::vector<RewardTerm> m_rewardTerms;  ///< Terms of the reward.
+    std::vector<int32_t> m_rewardValues;    ///< Previous values of each console's terms.
+    std::vector<uint8_t> m_observations;    ///< Observations batch.
+    std::vector<float> m_rewards;           ///< Rewards batch.
+    size_t m_observationSize;               ///< Size of one console's observation.
+
+    const uint8_t* m_actions;                        ///< Actions of the current step.
+    uint32_t m_frameskip;                            ///< Frames of the current step.
+    std::function<void(const uint32_t)> m_stepTask;  ///< Steps a console, built once.
+};
+
+#endif /* VECTORENV_H_ */
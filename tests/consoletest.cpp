@@ -0,0 +1,369 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      consoletest.cpp
+///
+/// \brief     Several consoles of different types running in one process.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "console.h"
+#include "consolearena.h"
+#include "hash.h"
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+/// \brief Run a console for some frames and hash its final state.
+uint64_t runConsole(const GBType type, const std::filesystem::path& cartPath)
+{
+    Console console(type, cartPath);
+    console.setAudioMode(ApuMode::eAPUMODE_statusonly);
+    console.powerOn();
+    for (uint32_t frame = 0; frame < 30; ++frame)
+    {
+        console.runFrame();
+    }
+
+    std::vector<uint8_t> state(console.getStateSize());
+    const size_t stateSize = console.saveState(state.data(), state.size());
+
+    return cbutil::hashXXH64(state.data(), stateSize);
+}
+
+/// \brief Hash the memory but the cartridge's RAM and the registers following the clocks.
+///
+/// DIV, STAT and LY follow the clocks since the power on, NR52 tells which channels still play and
+/// IF which interrupts are pending.
+uint64_t hashMemory(const Console& console)
+{
+    std::vector<uint8_t> memory;
+    for (uint32_t address = 0x8000; address <= 0xFFFF; ++address)
+    {
+        const bool cartridgeRAM = (address >= 0xA000) && (address < 0xC000);
+        const bool clockRegister = (address == 0xFF04) || (address == 0xFF0F) ||
+                                   (address == 0xFF26) || (address == 0xFF41) ||
+                                   (address == 0xFF44);
+        if ((cartridgeRAM == false) && (clockRegister == false))
+        {
+            memory.push_back(console.readMemory(address));
+        }
+    }
+
+    return cbutil::hashXXH64(memory.data(), memory.size());
+}
+
+/// \brief A cartridge passing the boot ROM's checks, looping at its entry point.
+std::vector<uint8_t> makeBootableROM()
+{
+    const uint8_t logo[] = {0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
+                            0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
+                            0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
+                            0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E};
+
+    std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+    std::copy(std::begin(logo), std::end(logo), rom.begin() + 0x0104);
+    // JR -2 at the entry point, and the checksum of the header's zeros.
+    rom[0x0100] = 0x18;
+    rom[0x0101] = 0xFE;
+    rom[0x014D] = 0xE7;
+
+    return rom;
+}
+
+/// \brief Run a console for some frames and hash its final state.
+uint64_t runFrames(Console& console, const uint32_t frames)
+{
+    for (uint32_t frame = 0; frame < frames; ++frame)
+    {
+        console.runFrame();
+    }
+
+    std::vector<uint8_t> state(console.getStateSize());
+    const size_t stateSize = console.saveState(state.data(), state.size());
+
+    return cbutil::hashXXH64(state.data(), stateSize);
+}
+
+}  // namespace
+
+TEST_CASE("Each console owns its configuration", "[console]")
+{
+    const Console dmg(GBType::eGBTYPE_dmg, "");
+    const Console cgb(GBType::eGBTYPE_cgb, "");
+
+    REQUIRE(dmg.getConfig().vRAMSize == MemoryAreasSizes::eMEMSIZE_vram);
+    REQUIRE(dmg.getConfig().wRAMSize == MemoryAreasSizes::eMEMSIZE_wram * 2);
+    REQUIRE(cgb.getConfig().vRAMSize == MemoryAreasSizes::eMEMSIZE_vram * 2);
+    REQUIRE(cgb.getConfig().wRAMSize == MemoryAreasSizes::eMEMSIZE_wram * 8);
+    REQUIRE(dmg.getStateSize() < cgb.getStateSize());
+}
+
+TEST_CASE("DMG and CGB consoles run concurrently", "[console]")
+{
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    const std::filesystem::path cartPath =
+        std::filesystem::temp_directory_path() / "colorboy-test-blank.gb";
+    {
+        std::ofstream cartFile(cartPath, std::ios::binary);
+        const std::vector<char> blankROM(2 * Cartridge::eROMBankSize, 0);
+        cartFile.write(blankROM.data(), blankROM.size());
+    }
+
+    const uint64_t dmgHash = runConsole(GBType::eGBTYPE_dmg, cartPath);
+    const uint64_t cgbHash = runConsole(GBType::eGBTYPE_cgb, cartPath);
+
+    // The consoles alternate types, each one must end as if it ran alone.
+    std::vector<uint64_t> hashes(8);
+    std::vector<std::thread> threads;
+    for (size_t consoleIdx = 0; consoleIdx < hashes.size(); ++consoleIdx)
+    {
+        threads.emplace_back([&hashes, &cartPath, consoleIdx]() {
+            const GBType type = ((consoleIdx % 2) == 0) ? GBType::eGBTYPE_dmg : GBType::eGBTYPE_cgb;
+            hashes[consoleIdx] = runConsole(type, cartPath);
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::filesystem::remove(cartPath);
+
+    for (size_t consoleIdx = 0; consoleIdx < hashes.size(); ++consoleIdx)
+    {
+        REQUIRE(hashes[consoleIdx] == (((consoleIdx % 2) == 0) ? dmgHash : cgbHash));
+    }
+}
+
+TEST_CASE("Clones and forks run like their source", "[console]")
+{
+    for (const GBType type : {GBType::eGBTYPE_dmg, GBType::eGBTYPE_cgb})
+    {
+        // A cartridge with a wrong logo: the boot ROM draws it into the VRAM then stops.
+        std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+        std::fill(rom.begin() + 0x0104, rom.begin() + 0x0134, 0xA5);
+        Console root(type, std::move(rom));
+        root.setAudioMode(ApuMode::eAPUMODE_statusonly);
+        root.powerOn();
+
+        const std::unique_ptr<Console> copy = root.clone();
+        copy->setAudioMode(ApuMode::eAPUMODE_statusonly);
+
+        ConsoleArena arena(root, 2, ConsoleArena::ForkMode::eFORKMODE_writtenPages);
+        const uint64_t snapshotHash = runFrames(root, 0);
+        const uint64_t rootHash = runFrames(root, 5);
+        REQUIRE(runFrames(*copy, 5) == rootHash);
+
+        // The second fork of the slot only copies back the pages written by the first one.
+        for (uint32_t forkIdx = 0; forkIdx < 3; ++forkIdx)
+        {
+            Console* fork = arena.fork();
+            REQUIRE(fork != nullptr);
+            fork->setAudioMode(ApuMode::eAPUMODE_statusonly);
+            REQUIRE(runFrames(*fork, 0) == snapshotHash);
+            REQUIRE(runFrames(*fork, 5) == rootHash);
+            arena.release(fork);
+        }
+
+        Console* first = arena.fork();
+        Console* second = arena.fork();
+        REQUIRE(first != second);
+        REQUIRE(arena.fork() == nullptr);
+        arena.release(first);
+        arena.release(second);
+
+        // Releasing twice, or releasing a console of another arena, frees no other slot.
+        arena.release(first);
+        arena.release(copy.get());
+        REQUIRE(arena.getFreeCount() == 2);
+    }
+}
+
+TEST_CASE("The fast start leaves the console as the boot ROM does", "[console]")
+{
+    for (const GBType type : {GBType::eGBTYPE_dmg, GBType::eGBTYPE_cgb})
+    {
+        Console booted(type, makeBootableROM());
+        booted.powerOn();
+        for (uint32_t chunk = 0; (chunk < 20000) && (booted.readMemory(0xFF50) == 0); ++chunk)
+        {
+            booted.runCycles(1000);
+        }
+        REQUIRE(booted.readMemory(0xFF50) == 1);
+
+        Console started(type, makeBootableROM());
+        started.powerOn(BootMode::eBOOTMODE_fastStart);
+        REQUIRE(started.readMemory(0xFF50) == 1);
+        REQUIRE(started.readMemory(0xFF0F) == 0xE1);
+        if (type == GBType::eGBTYPE_dmg)
+        {
+            REQUIRE(started.readMemory(0xFF04) == 0xAB);
+        }
+
+        // The cartridge replaces the boot ROM, the logo is in the VRAM.
+        for (uint32_t address = 0x0000; address < 0x0100; ++address)
+        {
+            REQUIRE(booted.readMemory(address) == 0x00);
+            REQUIRE(started.readMemory(address) == 0x00);
+        }
+        for (uint32_t address = 0x8000; address < 0xA000; ++address)
+        {
+            REQUIRE(started.readMemory(address) == booted.readMemory(address));
+        }
+        for (const uint16_t address : {0xFF24, 0xFF25, 0xFF40, 0xFF42, 0xFF43, 0xFF47})
+        {
+            REQUIRE(started.readMemory(address) == booted.readMemory(address));
+        }
+
+        // The state survives a save and a load.
+        std::vector<uint8_t> state(started.getStateSize());
+        started.saveState(state.data(), state.size());
+        Console loaded(type, makeBootableROM());
+        loaded.powerOn();
+        REQUIRE(loaded.loadState(state.data(), state.size()));
+        REQUIRE(loaded.readMemory(0x0000) == 0x00);
+        REQUIRE(runFrames(loaded, 10) == runFrames(started, 10));
+
+        // Both run the cartridge and their memories stay alike.
+        runFrames(booted, 10);
+        REQUIRE(hashMemory(booted) == hashMemory(started));
+    }
+}
+
+TEST_CASE("The ROM's banks 0 and 1 are mapped, the rest reads as the open bus", "[console]")
+{
+    std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+    rom[0x01FF] = 0x11;
+    rom[0x4000] = 0x42;
+    rom[0x7FFF] = 0x24;
+
+    Console console(GBType::eGBTYPE_dmg, rom);
+    REQUIRE(console.isCartridgeValid());
+    console.powerOn();
+    REQUIRE(console.runCycles(100));
+    REQUIRE(console.readMemory(0x01FF) == 0x11);
+    REQUIRE(console.readMemory(0x4000) == 0x42);
+    REQUIRE(console.readMemory(0x7FFF) == 0x24);
+    // No RAM in the cartridge.
+    REQUIRE(console.readMemory(0xA000) == 0xFF);
+
+    // A truncated ROM runs, its missing part reads as the open bus.
+    rom.resize(0x0200);
+    Console truncated(GBType::eGBTYPE_dmg, rom);
+    REQUIRE(truncated.isCartridgeValid() == false);
+    truncated.powerOn();
+    REQUIRE(truncated.runCycles(100));
+    REQUIRE(truncated.readMemory(0x01FF) == 0x11);
+    REQUIRE(truncated.readMemory(0x0200) == 0xFF);
+    REQUIRE(truncated.readMemory(0x4000) == 0xFF);
+}
+
+TEST_CASE("Metrics count the run-ahead frames and never go back", "[console]")
+{
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    Console console(GBType::eGBTYPE_dmg, std::vector<uint8_t>(2 * Cartridge::eROMBankSize, 0));
+    console.powerOn();
+    console.setRunAhead(2);
+
+    std::vector<uint8_t> state(console.getStateSize());
+    console.saveState(state.data(), state.size());
+
+    uint64_t emulatedClocks = 0;
+    for (uint32_t frame = 0; frame < 10; ++frame)
+    {
+        const uint64_t clock = console.getClock();
+        console.runFrame();
+        const uint64_t frameClocks = console.getClock() - clock;
+        if (frame == 5)
+        {
+            REQUIRE(console.loadState(state.data(), state.size()));
+        }
+
+        // The frame of the timeline and the 2 frames ahead.
+        const MetricsSnapshot snapshot = console.getMetrics().getSnapshot();
+        REQUIRE(snapshot.emulatedClocks > emulatedClocks + (2 * frameClocks));
+        REQUIRE(snapshot.haltedClocks <= snapshot.emulatedClocks);
+        emulatedClocks = snapshot.emulatedClocks;
+    }
+}
+
+TEST_CASE("STOP stops the CPU until the joypad's interrupt", "[console]")
+{
+    std::vector<uint8_t> rom = makeBootableROM();
+    // JP 0x0150, after the header.
+    const uint8_t entry[] = {0xC3, 0x50, 0x01};
+    std::copy(std::begin(entry), std::end(entry), rom.begin() + 0x0100);
+    // Disable the interrupts, select all the buttons, enable the joypad's interrupt only, STOP, then
+    // write 0x42 at 0xC000.
+    const uint8_t program[] = {0xF3, 0x3E, 0x00, 0xE0, 0x00, 0x3E, 0x10, 0xE0, 0xFF,
+                               0x10, 0x00, 0x3E, 0x42, 0xEA, 0x00, 0xC0, 0x18, 0xFE};
+    std::copy(std::begin(program), std::end(program), rom.begin() + 0x0150);
+
+    Console console(GBType::eGBTYPE_dmg, rom);
+    console.setAudioMode(ApuMode::eAPUMODE_statusonly);
+    console.powerOn();
+    // The boot ROM unmaps itself through 0xFF50 when it jumps to the cartridge.
+    for (uint32_t frame = 0; (frame < 1000) && (console.readMemory(0xFF50) == 0); ++frame)
+    {
+        REQUIRE(console.runFrame());
+    }
+    REQUIRE(console.readMemory(0xFF50) != 0);
+
+    REQUIRE(console.runFrame());
+    REQUIRE(console.runFrame());
+    REQUIRE(console.readMemory(0xC000) == 0x00);
+
+    console.setJoypadButtons(0x01);
+    REQUIRE(console.runFrame());
+    REQUIRE(console.readMemory(0xC000) == 0x42);
+}
+
+TEST_CASE("Each TIMA overflow runs the timer's handler once", "[console]")
+{
+    std::vector<uint8_t> rom = makeBootableROM();
+    // The timer's handler counts its runs at 0xC000: INC (HL), RETI.
+    rom[0x0050] = 0x34;
+    rom[0x0051] = 0xD9;
+    // JP 0x0150, after the header.
+    const uint8_t entry[] = {0xC3, 0x50, 0x01};
+    std::copy(std::begin(entry), std::end(entry), rom.begin() + 0x0100);
+    // HL = 0xC000, enable the timer's interrupt only, start the timer at 262144 Hz, EI, loop.
+    const uint8_t program[] = {0x21, 0x00, 0xC0, 0x3E, 0x04, 0xE0, 0xFF, 0x3E,
+                               0x05, 0xE0, 0x07, 0xFB, 0x18, 0xFE};
+    std::copy(std::begin(program), std::end(program), rom.begin() + 0x0150);
+
+    Console console(GBType::eGBTYPE_dmg, rom);
+    console.powerOn(BootMode::eBOOTMODE_fastStart);
+    const uint64_t startClock = console.getClock();
+    REQUIRE(console.runCycles(100000));
+
+    // TMA is 0: TIMA overflows every 256 increments of 16 clocks, from a phase set by DIV.
+    const uint64_t overflowsCount = (console.getClock() - startClock) / 4096;
+    const uint8_t handlerRunsCount = console.readMemory(0xC000);
+    REQUIRE(handlerRunsCount + 1 >= overflowsCount);
+    REQUIRE(handlerRunsCount <= overflowsCount + 1);
+}
@@ -0,0 +1,78 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      movietest.cpp
+///
+/// \brief     Joypad movies recorded and replayed by a console.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "cartridge.h"
+#include "console.h"
+
+#include <fstream>
+#include <vector>
+
+TEST_CASE("Empty or truncated movies are not played", "[movie]")
+{
+    const std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+    const std::filesystem::path cartPath = tempDir / "colorboy-test-movie.gb";
+    const std::filesystem::path moviePath = tempDir / "colorboy-test-movie.cbm";
+
+    // A blank cartridge: the boot ROM runs and then waits for a valid logo forever.
+    {
+        std::ofstream cartFile(cartPath, std::ios::binary);
+        const std::vector<char> blankROM(2 * Cartridge::eROMBankSize, 0);
+        cartFile.write(blankROM.data(), blankROM.size());
+    }
+
+    Console console(GBType::eGBTYPE_dmg, cartPath);
+    console.setAudioMode(ApuMode::eAPUMODE_statusonly);
+    console.powerOn();
+
+    // Stopped before its first frame, the movie has nothing to check.
+    REQUIRE(console.startMovieRecording());
+    REQUIRE(console.stopMovieRecording(moviePath));
+    REQUIRE(console.playMovie(moviePath) == false);
+
+    REQUIRE(console.startMovieRecording());
+    for (uint32_t frame = 0; frame < 3; ++frame)
+    {
+        REQUIRE(console.runFrame());
+    }
+    REQUIRE(console.stopMovieRecording(moviePath));
+    REQUIRE(console.playMovie(moviePath));
+    for (uint32_t frame = 0; frame < 3; ++frame)
+    {
+        REQUIRE(console.runFrame());
+    }
+    REQUIRE(console.isMoviePlaying() == false);
+    REQUIRE(console.getMovieMismatchesCount() == 0);
+
+    // The header announces more than the file holds.
+    std::filesystem::resize_file(moviePath, std::filesystem::file_size(moviePath) - 1);
+    REQUIRE(console.playMovie(moviePath) == false);
+
+    std::filesystem::remove(moviePath);
+    std::filesystem::remove(cartPath);
+}
@@ -0,0 +1,189 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      rewindbuffertest.cpp
+///
+/// \brief     Round trips of the rewind buffer's compressed states through its rings.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "rewindbuffer.h"
+
+#include <vector>
+
+namespace
+{
+/// \brief Size of the states, its last bytes do not fill a 64 bits word.
+const size_t stateSize = 1027;
+
+/// \brief State of a frame: a fixed pattern with a few bytes changing on every frame.
+std::vector<uint8_t> makeState(const uint32_t frame)
+{
+    std::vector<uint8_t> state(stateSize);
+    for (size_t byteIdx = 0; byteIdx < state.size(); ++byteIdx)
+    {
+        state[byteIdx] = static_cast<uint8_t>(byteIdx * 7);
+    }
+
+    state[8] = static_cast<uint8_t>(frame);
+    state[9] = static_cast<uint8_t>(frame >> 8);
+    state[(frame * 13) % (stateSize - 8)] ^= 0xFF;
+    state[stateSize - 1] = static_cast<uint8_t>(frame * 3);
+
+    return state;
+}
+
+/// \brief State of a frame without any run of equal words, nor with the previous frame.
+std::vector<uint8_t> makeNoisyState(const uint32_t frame)
+{
+    std::vector<uint8_t> state(stateSize);
+    uint32_t random = (frame + 1) * 2654435761u;
+    for (uint8_t& byte : state)
+    {
+        random = (random * 1103515245) + 12345;
+        byte = static_cast<uint8_t>((random >> 16) | 0x01);
+    }
+
+    return state;
+}
+
+/// \brief Go back one frame at a time and check every state, from the last to the oldest one.
+///
+/// \param buffer rewind buffer, empty after the check.
+/// \param lastFrame frame of the last recorded state.
+/// \param makeFrameState builds the state recorded for a frame.
+void checkHistory(RewindBuffer& buffer,
+                  const uint32_t lastFrame,
+                  std::vector<uint8_t> (*makeFrameState)(const uint32_t))
+{
+    std::vector<uint8_t> state(stateSize);
+    REQUIRE(buffer.rewind(0, state.data()));
+    REQUIRE(state == makeFrameState(lastFrame));
+
+    const uint32_t framesCount = buffer.getFramesCount();
+    for (uint32_t back = 1; back < framesCount; ++back)
+    {
+        REQUIRE(buffer.rewind(1, state.data()));
+        REQUIRE(state == makeFrameState(lastFrame - back));
+    }
+
+    REQUIRE(buffer.getFramesCount() == 1);
+    REQUIRE(buffer.rewind(1, state.data()) == false);
+}
+
+}  // namespace
+
+TEST_CASE("States go back and forth across keyframes", "[rewindbuffer]")
+{
+    RewindBuffer buffer(stateSize, 1024 * 1024, 4);
+    for (uint32_t frame = 0; frame < 10; ++frame)
+    {
+        REQUIRE(buffer.push(makeState(frame).data()));
+    }
+    REQUIRE(buffer.getFramesCount() == 10);
+
+    // Back to a delta right after a keyframe: the states that followed are forgotten.
+    std::vector<uint8_t> state(stateSize);
+    REQUIRE(buffer.rewind(4, state.data()));
+    REQUIRE(state == makeState(5));
+    REQUIRE(buffer.getFramesCount() == 6);
+
+    // A new timeline starts from there, its deltas refer to the restored state.
+    for (uint32_t frame = 100; frame < 107; ++frame)
+    {
+        REQUIRE(buffer.push(makeState(frame).data()));
+    }
+    REQUIRE(buffer.rewind(0, state.data()));
+    REQUIRE(state == makeState(106));
+    REQUIRE(buffer.rewind(7, state.data()));
+    REQUIRE(state == makeState(5));
+
+    for (uint32_t frame = 6; frame < 20; ++frame)
+    {
+        REQUIRE(buffer.push(makeState(frame).data()));
+    }
+    checkHistory(buffer, 19, makeState);
+}
+
+TEST_CASE("The oldest states are evicted to stay in the budget", "[rewindbuffer]")
+{
+    // Room for a few hundred deltas: both rings wrap around many times.
+    const size_t budget = 32 * 1024;
+    RewindBuffer buffer(stateSize, budget, 8);
+    const uint32_t framesCount = 5000;
+    for (uint32_t frame = 0; frame < framesCount; ++frame)
+    {
+        REQUIRE(buffer.push(makeState(frame).data()));
+        REQUIRE(buffer.getUsedBytes() < budget);
+    }
+
+    REQUIRE(buffer.getFramesCount() > 8);
+    REQUIRE(buffer.getFramesCount() < framesCount / 4);
+    checkHistory(buffer, framesCount - 1, makeState);
+}
+
+TEST_CASE("A delta whose keyframe is evicted becomes a keyframe", "[rewindbuffer]")
+{
+    // A single keyframe: making room for a delta evicts it with all the history.
+    RewindBuffer buffer(stateSize, 16 * 1024, 100000);
+    bool historyLost = false;
+    for (uint32_t frame = 0; (frame < 100000) && (historyLost == false); ++frame)
+    {
+        REQUIRE(buffer.push(makeState(frame).data()));
+        historyLost = (frame > 0) && (buffer.getFramesCount() == 1);
+
+        if (historyLost == true)
+        {
+            // The new frame is decoded alone, then deltas follow it again.
+            for (uint32_t nextFrame = frame + 1; nextFrame <= frame + 5; ++nextFrame)
+            {
+                REQUIRE(buffer.push(makeState(nextFrame).data()));
+            }
+            REQUIRE(buffer.getFramesCount() == 6);
+            checkHistory(buffer, frame + 5, makeState);
+        }
+    }
+
+    REQUIRE(historyLost == true);
+}
+
+TEST_CASE("States that do not compress are recorded whole", "[rewindbuffer]")
+{
+    // Each state is bigger compressed than raw, only a few of them fit.
+    const size_t budget = 16 * 1024;
+    RewindBuffer buffer(stateSize, budget, 4);
+    for (uint32_t frame = 0; frame < 50; ++frame)
+    {
+        REQUIRE(buffer.push(makeNoisyState(frame).data()));
+        REQUIRE(buffer.getUsedBytes() >= buffer.getFramesCount() * stateSize);
+        REQUIRE(buffer.getUsedBytes() < budget);
+    }
+
+    REQUIRE(buffer.getFramesCount() > 1);
+    checkHistory(buffer, 49, makeNoisyState);
+
+    // A state bigger than the whole ring is refused.
+    RewindBuffer tinyBuffer(stateSize, 4 * 1024, 4);
+    REQUIRE(tinyBuffer.push(makeNoisyState(0).data()) == false);
+    REQUIRE(tinyBuffer.getFramesCount() == 0);
+}
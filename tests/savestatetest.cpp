@@ -0,0 +1,59 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      savestatetest.cpp
+///
+/// \brief     Save states written and loaded by a console.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "console.h"
+#include "savestate.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("States selecting missing memory banks are rejected", "[savestate]")
+{
+    Console console(GBType::eGBTYPE_dmg, "");
+
+    std::vector<uint8_t> state(console.getStateSize());
+    REQUIRE(console.saveState(state.data(), state.size()) == state.size());
+    const uint8_t tag[] = {'C', 'O', 'N', 'S'};
+    const auto section = std::search(state.begin(), state.end(), std::begin(tag), std::end(tag));
+    REQUIRE(section != state.end());
+    // The section holds the console's type, then its VRAM and WRAM banks.
+    const size_t banksOffset = (section - state.begin()) + savestate::eSectionHeaderSize + 1;
+
+    // A DMG has one VRAM bank and one switchable WRAM bank.
+    const std::pair<uint8_t, uint8_t> invalidBanks[] = {{1, 1}, {0, 0}, {0, 2}, {0, 8}};
+    for (const auto& [vramBank, wramBank] : invalidBanks)
+    {
+        std::vector<uint8_t> corrupted = state;
+        corrupted[banksOffset] = vramBank;
+        corrupted[banksOffset + 1] = wramBank;
+        REQUIRE(console.loadState(corrupted.data(), corrupted.size()) == false);
+    }
+
+    REQUIRE(console.loadState(state.data(), state.size()));
+}
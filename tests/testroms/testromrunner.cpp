@@ -0,0 +1,221 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      testromrunner.cpp
+///
+/// \brief     Headless runner of the test ROMs printing their results on the serial port.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "console.h"
+#include "threadpool.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+
+namespace
+{
+/// \brief Master clocks in one emulated second.
+constexpr uint64_t clocksPerSecond = 4194304;
+
+/// \brief Outcome of a test ROM.
+struct TestResult
+{
+    const char* status = "timeout";  ///< "passed", "failed", "timeout" or "error".
+    uint64_t clocks = 0;             ///< Emulated master clocks.
+    double wallMs = 0.0;             ///< Wall time of the run.
+    std::string serialOutput;        ///< Text printed by the ROM.
+};
+
+/// \brief Serializes the output lines and the results file.
+std::mutex outputMutex;
+
+/// \brief Escape a string for a JSON string literal.
+std::string escapeJSON(const std::string& text)
+{
+    std::string escaped;
+    for (const char character : text)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            escaped += '\\';
+            escaped += character;
+        }
+        else if (character == '\n')
+        {
+            escaped += "\\n";
+        }
+        else
+        {
+            escaped += ((character >= 0) && (character < 0x20)) ? ' ' : character;
+        }
+    }
+
+    return escaped;
+}
+
+/// \brief Run a test ROM until it prints its verdict or the timeout expires.
+TestResult runTestROM(const std::filesystem::path& romPath,
+                      const GBType type,
+                      const uint64_t timeoutClocks)
+{
+    TestResult result;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    Console console(type, romPath);
+    if (console.isCartridgeValid() == false)
+    {
+        result.status = "error";
+        return result;
+    }
+
+    console.setAudioMode(ApuMode::eAPUMODE_statusonly);
+    console.powerOn();
+
+    // The ROMs print their name, the failed tests, then "Passed" or "Failed".
+    while (console.getClock() < timeoutClocks)
+    {
+        if (console.runFrame() == false)
+        {
+            result.status = "error";
+            break;
+        }
+
+        const std::string& output = console.getSerialOutput();
+        if (output.find("Failed") != std::string::npos)
+        {
+            result.status = "failed";
+            break;
+        }
+        if (output.find("Passed") != std::string::npos)
+        {
+            result.status = "passed";
+            break;
+        }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    result.wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+    result.clocks = console.getClock();
+    result.serialOutput = console.getSerialOutput();
+
+    return result;
+}
+
+/// \brief Print the result of a test ROM as a JSON line, and append it to the results file.
+void printResult(const std::filesystem::path& romPath,
+                 const TestResult& result,
+                 const std::filesystem::path& resultsPath)
+{
+    const double emulatedMHz = (result.wallMs > 0.0) ? result.clocks / (result.wallMs * 1e3) : 0.0;
+
+    char line[512];
+    std::snprintf(line,
+                  sizeof(line),
+                  "{\"rom\":\"%s\",\"status\":\"%s\",\"clocks\":%" PRIu64 ",\"wall_ms\":%.3f,"
+                  "\"emulated_mhz\":%.3f}\n",
+                  escapeJSON(romPath.string()).c_str(),
+                  result.status,
+                  result.clocks,
+                  result.wallMs,
+                  emulatedMHz);
+
+    std::lock_guard<std::mutex> lock(outputMutex);
+    std::fputs(line, stdout);
+    if (std::string(result.status) != "passed")
+    {
+        std::fprintf(stderr, "%s\n", result.serialOutput.c_str());
+    }
+
+    if (resultsPath.empty() == false)
+    {
+        std::unique_ptr<FILE, decltype(&fclose)> resultsFile(
+            std::fopen(resultsPath.string().c_str(), "a"), &fclose);
+        if (resultsFile != nullptr)
+        {
+            std::fputs(line, resultsFile.get());
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::filesystem::path> romPaths;
+    std::filesystem::path resultsPath;
+    GBType type = GBType::eGBTYPE_dmg;
+    uint64_t timeoutSeconds = 120;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string arg = argv[argIdx];
+        // --timeout SECONDS: emulated seconds before a ROM without verdict fails.
+        if ((arg == "--timeout") && (argIdx + 1 < argc))
+        {
+            timeoutSeconds = std::strtoull(argv[++argIdx], nullptr, 10);
+        }
+        // --type dmg|cgb: Game Boy type running the ROMs.
+        else if ((arg == "--type") && (argIdx + 1 < argc))
+        {
+            type = (std::string(argv[++argIdx]) == "cgb") ? GBType::eGBTYPE_cgb :
+                                                             GBType::eGBTYPE_dmg;
+        }
+        // --results FILE: append the results to a JSON lines file.
+        else if ((arg == "--results") && (argIdx + 1 < argc))
+        {
+            resultsPath = argv[++argIdx];
+        }
+        else
+        {
+            romPaths.push_back(arg);
+        }
+    }
+
+    if (romPaths.empty() == true)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s [--timeout SECONDS] [--type dmg|cgb] [--results FILE] ROM...\n",
+                     argv[0]);
+        return 1;
+    }
+
+    // The calling thread runs ROMs too.
+    const uint32_t threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    ThreadPool threadPool(std::min<uint32_t>(threadsCount, romPaths.size()) - 1);
+
+    std::vector<TestResult> results(romPaths.size());
+    threadPool.parallelFor(static_cast<uint32_t>(romPaths.size()), [&](const uint32_t romIdx) {
+        results[romIdx] = runTestROM(romPaths[romIdx], type, timeoutSeconds * clocksPerSecond);
+        printResult(romPaths[romIdx], results[romIdx], resultsPath);
+    });
+
+    uint32_t passedCount = 0;
+    for (const TestResult& result : results)
+    {
+        passedCount += (std::string(result.status) == "passed") ? 1 : 0;
+    }
+
+    return (passedCount == results.size()) ? 0 : 1;
+}
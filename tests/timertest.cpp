@@ -0,0 +1,285 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      timertest.cpp
+///
+/// \brief     The timer's computed overflows against a timer stepped on every clock.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "cpu.h"
+#include "timer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+/// \brief Write of a timer register at a master clock.
+struct TimerWrite
+{
+    uint64_t clock;    ///< Master clock of the write.
+    uint16_t address;  ///< Written register.
+    uint8_t value;     ///< Written value.
+};
+
+/// \brief Timer stepped on every clock, as the hardware counts.
+///
+/// TIMA ticks on each falling edge of the internal counter's bit selected by TAC. Like the
+/// emulated timer, it leaves the DMG's glitches on TAC writes out.
+struct ReferenceTimer
+{
+    /// \brief Get the counter's bit whose falling edge ticks TIMA.
+    uint16_t getWatchedBit() const
+    {
+        static constexpr uint16_t watchedBits[] = {0x0200, 0x0008, 0x0020, 0x0080};
+        return watchedBits[tac & 0x03];
+    }
+
+    /// \brief Tick TIMA, reloading TMA and requesting the interrupt when it overflows.
+    void tick()
+    {
+        if (tima == 0xFF)
+        {
+            tima = tma;
+            interruptRequested = true;
+        }
+        else
+        {
+            ++tima;
+        }
+    }
+
+    /// \brief Run one master clock.
+    void clock()
+    {
+        const uint16_t previousCounter = counter++;
+        if (((tac & 0x04) != 0) && ((previousCounter & getWatchedBit()) != 0) &&
+            ((counter & getWatchedBit()) == 0))
+        {
+            tick();
+        }
+    }
+
+    /// \brief Write a timer register.
+    void write(const uint16_t address, const uint8_t value)
+    {
+        switch (address)
+        {
+        case HardwareIORegisters::eIOREG_div:
+            // The counter drops to 0: a set watched bit falls.
+            if (((tac & 0x04) != 0) && ((counter & getWatchedBit()) != 0))
+            {
+                tick();
+            }
+            counter = 0;
+            break;
+
+        case HardwareIORegisters::eIOREG_tima: tima = value; break;
+        case HardwareIORegisters::eIOREG_tma: tma = value; break;
+        case HardwareIORegisters::eIOREG_tac: tac = value & 0x07; break;
+        }
+    }
+
+    uint16_t counter = 0;             ///< Internal counter, DIV is its high byte.
+    uint8_t tima = 0;                 ///< Timer counter.
+    uint8_t tma = 0;                  ///< Timer modulo.
+    uint8_t tac = 0;                  ///< Timer control.
+    bool interruptRequested = false;  ///< Is the timer interrupt pending?
+};
+
+/// \brief Counts of the cases met while comparing the timers.
+struct TimerCoverage
+{
+    uint32_t overflows = 0;           ///< TIMA overflows, each one reloads TMA.
+    uint32_t divFallingEdges = 0;     ///< DIV writes ticking TIMA.
+    uint32_t tacMidPeriodWrites = 0;  ///< TAC writes between two ticks of a running timer.
+};
+
+/// \brief Run the timer and the reference timer clock by clock, through the same writes.
+///
+/// \param writes register writes, in the order of their clocks.
+/// \param clocks clocks to run.
+///
+/// \return the cases met.
+TimerCoverage compareWithReference(const std::vector<TimerWrite>& writes, const uint64_t clocks)
+{
+    Mmu mmu;
+    std::vector<uint8_t> memory(0x10000, 0);
+    mmu.mapDataBufferToMemory(memory, 0);
+    Scheduler scheduler;
+    Timer timer(mmu, scheduler);
+    ReferenceTimer reference;
+
+    TimerCoverage coverage;
+    size_t writeIdx = 0;
+    for (uint64_t clock = 0; clock < clocks; ++clock)
+    {
+        for (; (writeIdx < writes.size()) && (writes[writeIdx].clock == clock); ++writeIdx)
+        {
+            const TimerWrite& write = writes[writeIdx];
+            const bool running = ((reference.tac & 0x04) != 0);
+            const uint16_t watchedBit = reference.getWatchedBit();
+            if ((write.address == HardwareIORegisters::eIOREG_div) && (running == true) &&
+                ((reference.counter & watchedBit) != 0))
+            {
+                ++coverage.divFallingEdges;
+            }
+            if ((write.address == HardwareIORegisters::eIOREG_tac) && (running == true) &&
+                ((reference.counter & ((watchedBit * 2) - 1)) != 0))
+            {
+                ++coverage.tacMidPeriodWrites;
+            }
+
+            mmu.writeByte(write.value, write.address);
+            reference.write(write.address, write.value);
+        }
+
+        scheduler.advance(1);
+        reference.clock();
+
+        REQUIRE(mmu.readByte(HardwareIORegisters::eIOREG_div) == (reference.counter >> 8));
+        REQUIRE(mmu.readByte(HardwareIORegisters::eIOREG_tima) == reference.tima);
+
+        const bool interruptRequested =
+            (mmu.readByte(HardwareIORegisters::eIOREG_if) & InterruptFlags::eINTFLAG_timer) != 0;
+        REQUIRE(interruptRequested == reference.interruptRequested);
+        if (interruptRequested == true)
+        {
+            ++coverage.overflows;
+            mmu.writeByte(0x00, HardwareIORegisters::eIOREG_if);
+            reference.interruptRequested = false;
+        }
+    }
+
+    return coverage;
+}
+
+}  // namespace
+
+TEST_CASE("TIMA overflows reload TMA", "[timer]")
+{
+    const std::vector<TimerWrite> writes = {{0, HardwareIORegisters::eIOREG_tma, 0xF0},
+                                            {0, HardwareIORegisters::eIOREG_tima, 0xFE},
+                                            {0, HardwareIORegisters::eIOREG_tac, 0x05},
+                                            {1500, HardwareIORegisters::eIOREG_tma, 0x80}};
+
+    const TimerCoverage coverage = compareWithReference(writes, 4000);
+    REQUIRE(coverage.overflows > 5);
+}
+
+TEST_CASE("TAC changes take effect in the middle of a period", "[timer]")
+{
+    const std::vector<TimerWrite> writes = {{0, HardwareIORegisters::eIOREG_tac, 0x05},
+                                            {1001, HardwareIORegisters::eIOREG_tac, 0x06},
+                                            {3333, HardwareIORegisters::eIOREG_tac, 0x07},
+                                            {5555, HardwareIORegisters::eIOREG_tac, 0x04},
+                                            {9000, HardwareIORegisters::eIOREG_tac, 0x00},
+                                            {9500, HardwareIORegisters::eIOREG_tac, 0x05},
+                                            {9517, HardwareIORegisters::eIOREG_tac, 0x04}};
+
+    const TimerCoverage coverage = compareWithReference(writes, 20000);
+    REQUIRE(coverage.tacMidPeriodWrites >= 4);
+}
+
+TEST_CASE("DIV writes tick TIMA on a falling edge", "[timer]")
+{
+    std::vector<TimerWrite> writes = {{0, HardwareIORegisters::eIOREG_tac, 0x05}};
+    for (uint64_t clock = 100; clock < 2000; clock += 13)
+    {
+        writes.push_back({clock, HardwareIORegisters::eIOREG_div, 0x00});
+    }
+
+    const TimerCoverage coverage = compareWithReference(writes, 3000);
+    REQUIRE(coverage.divFallingEdges > 10);
+}
+
+TEST_CASE("The timer matches the reference through random writes", "[timer]")
+{
+    const uint16_t registers[] = {HardwareIORegisters::eIOREG_div,
+                                  HardwareIORegisters::eIOREG_tima,
+                                  HardwareIORegisters::eIOREG_tma,
+                                  HardwareIORegisters::eIOREG_tac};
+
+    // A fixed linear congruential sequence: the same writes on every run.
+    uint32_t random = 12345;
+    const auto next = [&random]() {
+        random = (random * 1103515245) + 12345;
+        return random >> 16;
+    };
+
+    std::vector<TimerWrite> writes;
+    for (uint64_t clock = next() % 64; clock < 40000; clock += 1 + (next() % 400))
+    {
+        const uint16_t address = registers[next() % 4];
+        // TIMA and TMA stay high for frequent overflows, TAC keeps the timer running mostly.
+        uint8_t value = static_cast<uint8_t>(0xC0 | next());
+        if (address == HardwareIORegisters::eIOREG_tac)
+        {
+            value = static_cast<uint8_t>(next() % 4) | (((next() % 4) != 0) ? 0x04 : 0x00);
+        }
+        writes.push_back({clock, address, value});
+    }
+
+    const TimerCoverage coverage = compareWithReference(writes, 40000);
+    REQUIRE(coverage.overflows > 0);
+    REQUIRE(coverage.divFallingEdges > 0);
+    REQUIRE(coverage.tacMidPeriodWrites > 0);
+}
+
+TEST_CASE("Each TIMA overflow runs the CPU's timer handler once", "[timer]")
+{
+    Mmu mmu;
+    Scheduler scheduler;
+    Timer timer(mmu, scheduler);
+    Cpu cpu(mmu);
+
+    // The program replaces the CPU's boot ROM: it enables the timer's interrupt only, starts TIMA
+    // at 16 clocks per tick and loops. The handler counts its runs at 0xC000.
+    std::vector<uint8_t> memory(0x10000, 0);
+    const uint8_t program[] = {0x31, 0xFE, 0xFF,  // LD SP, 0xFFFE
+                               0x21, 0x00, 0xC0,  // LD HL, 0xC000
+                               0x3E, 0x04,        // LD A, 0x04
+                               0xE0, 0xFF,        // LDH (IE), A
+                               0x3E, 0x05,        // LD A, 0x05
+                               0xE0, 0x07,        // LDH (TAC), A
+                               0xFB,              // EI
+                               0x18, 0xFE};       // JR -2
+    std::copy(std::begin(program), std::end(program), memory.begin());
+    memory[InterruptAddresses::eINTADDR_timer] = 0x34;      // INC (HL)
+    memory[InterruptAddresses::eINTADDR_timer + 1] = 0xD9;  // RETI
+    mmu.mapDataBufferToMemory(memory, 0);
+
+    const uint64_t clocks = 100000;
+    for (uint64_t clock = 0; clock < clocks; clock += 4)
+    {
+        REQUIRE(cpu.cycle());
+        scheduler.advance(4);
+    }
+
+    // TIMA overflows every 256 ticks, the last overflow may still wait for its dispatch.
+    const uint64_t overflows = clocks / (256 * 16);
+    const uint8_t handlerRuns = mmu.readByte(0xC000);
+    REQUIRE(handlerRuns + 1 >= overflows);
+    REQUIRE(handlerRuns <= overflows);
+}
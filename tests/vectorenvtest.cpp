@@ -0,0 +1,151 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      vectorenvtest.cpp
+///
+/// \brief     Reward expressions and batched steps of the reinforcement learning environment.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "catch.hpp"
+
+#include "vectorenv.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+/// \brief A cartridge with a wrong logo: the boot ROM draws it then stops.
+std::vector<uint8_t> makeLogoROM()
+{
+    std::vector<uint8_t> rom(2 * Cartridge::eROMBankSize, 0);
+    std::fill(rom.begin() + 0x0104, rom.begin() + 0x0134, 0xA5);
+
+    return rom;
+}
+
+}  // namespace
+
+TEST_CASE("Reward expressions are parsed", "[vectorenv]")
+{
+    std::vector<RewardTerm> terms;
+
+    REQUIRE(parseRewardExpression("delta(u16[0xD347]) - 0.5*u8[D057] + u8[ 0xC000 ]", terms));
+    REQUIRE(terms.size() == 3);
+    REQUIRE(terms[0].address == 0xD347);
+    REQUIRE(terms[0].word == true);
+    REQUIRE(terms[0].delta == true);
+    REQUIRE(terms[0].weight == 1.0f);
+    REQUIRE(terms[1].address == 0xD057);
+    REQUIRE(terms[1].word == false);
+    REQUIRE(terms[1].delta == false);
+    REQUIRE(terms[1].weight == -0.5f);
+    REQUIRE(terms[2].address == 0xC000);
+
+    REQUIRE(parseRewardExpression("-2*u8[FF44]", terms));
+    REQUIRE(terms.size() == 1);
+    REQUIRE(terms[0].weight == -2.0f);
+
+    for (const char* invalid : {"", "u8[0x10000]", "u8[C000", "2*", "2 u8[C000]", "ram[C000]",
+                                "delta(u8[C000]", "u8[C000] u8[C001]"})
+    {
+        REQUIRE(parseRewardExpression(invalid, terms) == false);
+    }
+}
+
+TEST_CASE("Batched steps match on any number of threads", "[vectorenv]")
+{
+    VectorEnvConfig config;
+    config.envsCount = 4;
+    config.screenScale = 4;
+    config.threadsCount = 0;
+
+    VectorEnv serial(GBType::eGBTYPE_dmg, makeLogoROM(), config);
+    config.threadsCount = 2;
+    VectorEnv parallel(GBType::eGBTYPE_dmg, makeLogoROM(), config);
+
+    REQUIRE(serial.getObservationSize() == (160 / 4) * (144 / 4));
+    REQUIRE(serial.setReward("delta(u8[0xFF42]) + u8[0xFF40]"));
+    REQUIRE(parallel.setReward("delta(u8[0xFF42]) + u8[0xFF40]"));
+    REQUIRE(serial.setReward("u8[") == false);
+
+    const size_t batchSize = serial.getObservationSize() * serial.getEnvsCount();
+    const std::vector<uint8_t> start(serial.getObservations(),
+                                     serial.getObservations() + serial.getObservationSize());
+    const uint8_t actions[] = {0, JoypadButtons::eBUTTON_a, 0, JoypadButtons::eBUTTON_start};
+    for (uint32_t step = 0; step < 30; ++step)
+    {
+        serial.step(actions, 4);
+        parallel.step(actions, 4);
+
+        REQUIRE(std::memcmp(serial.getObservations(), parallel.getObservations(), batchSize) == 0);
+        REQUIRE(std::equal(serial.getRewards(), serial.getRewards() + serial.getEnvsCount(),
+                           parallel.getRewards()));
+    }
+
+    // The boot ROM ignores the joypad: every console shows the same screen, the logo.
+    const uint8_t* observations = serial.getObservations();
+    REQUIRE(std::memcmp(observations,
+                        observations + serial.getObservationSize(),
+                        serial.getObservationSize()) == 0);
+    REQUIRE(std::any_of(observations,
+                        observations + serial.getObservationSize(),
+                        [&](const uint8_t luma) { return luma != observations[0]; }));
+
+    // A reset brings the start state back, the other consoles carry on.
+    REQUIRE(std::memcmp(observations, start.data(), start.size()) != 0);
+    serial.reset(0);
+    REQUIRE(serial.getRewards()[0] == 0.0f);
+    REQUIRE(std::memcmp(observations, start.data(), start.size()) == 0);
+    serial.step(actions, 4);
+    parallel.reset(0);
+    parallel.step(actions, 4);
+    REQUIRE(std::memcmp(serial.getObservations(), parallel.getObservations(), batchSize) == 0);
+
+    // The start state may come from one of the consoles.
+    REQUIRE(serial.setStartState(serial.getConsole(1)));
+    REQUIRE(std::memcmp(observations,
+                        observations + (3 * serial.getObservationSize()),
+                        serial.getObservationSize()) == 0);
+}
+
+TEST_CASE("The memory is observed", "[vectorenv]")
+{
+    VectorEnvConfig config;
+    config.envsCount = 2;
+    config.observation = Observation::eOBSERVATION_ram;
+    config.ramAddresses = {0xFF40, 0xFF47, 0xFF50};
+
+    VectorEnv env(GBType::eGBTYPE_dmg, makeLogoROM(), config);
+    const uint8_t actions[] = {0, 0};
+    env.step(actions, 60);
+
+    REQUIRE(env.getObservationSize() == 3);
+    for (uint32_t envIdx = 0; envIdx < env.getEnvsCount(); ++envIdx)
+    {
+        for (size_t byteIdx = 0; byteIdx < config.ramAddresses.size(); ++byteIdx)
+        {
+            REQUIRE(env.getObservations()[(envIdx * 3) + byteIdx] ==
+                    env.getConsole(envIdx).readMemory(config.ramAddresses[byteIdx]));
+        }
+    }
+}
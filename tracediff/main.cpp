@@ -0,0 +1,232 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      main.cpp
+///
+/// \brief     Finds the first instruction where two CPU traces diverge.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "tracereader.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// \brief Print a record in the gameboy-doctor style.
+///
+/// \param label trace's name.
+/// \param index instruction's index since the start of the comparison.
+/// \param record the instruction.
+/// \param withCycle print the cycle relative to the start of the comparison?
+/// \param firstCycle cycle of the first compared instruction.
+void printRecord(const char* const label,
+                 const uint64_t index,
+                 const cputrace::Record& record,
+                 const bool withCycle,
+                 const uint32_t firstCycle)
+{
+    std::printf("%s %10" PRIu64 "  A:%02X F:%02X B:%02X C:%02X D:%02X E:%02X H:%02X L:%02X "
+                "SP:%04X PC:%04X OP:%02X",
+                label,
+                index,
+                record.a,
+                record.f,
+                record.b,
+                record.c,
+                record.d,
+                record.e,
+                record.h,
+                record.l,
+                record.sp,
+                record.pc,
+                record.opcode);
+    if (withCycle == true)
+    {
+        std::printf(" CY:%u", record.cycle - firstCycle);
+    }
+    std::printf("\n");
+}
+
+/// \brief Read the first record of a trace, at the first instruction at an address if any.
+///
+/// \return true if a record was read, false at the end of the trace.
+bool readFirst(TraceReader& reader, const int32_t fromAddress, cputrace::Record& record)
+{
+    while (reader.next(record) == true)
+    {
+        if ((fromAddress < 0) || (record.pc == fromAddress))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// \brief Report the error of a trace, if it has one.
+///
+/// \return true if the trace stopped on an error.
+bool reportError(const char* const path, const TraceReader& reader)
+{
+    if (reader.getError().empty() == true)
+    {
+        return false;
+    }
+    std::fprintf(stderr, "%s: %s\n", path, reader.getError().c_str());
+
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<const char*> paths;
+    int32_t fromAddress = -1;
+    uint32_t contextSize = 8;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string arg = argv[argIdx];
+        // --from ADDRESS: both traces start at their first instruction at ADDRESS, e.g. 0x0100 to
+        // compare a trace of the boot ROM with a log starting at the cartridge's entry point.
+        if ((arg == "--from") && (argIdx + 1 < argc))
+        {
+            fromAddress = static_cast<int32_t>(std::strtol(argv[++argIdx], nullptr, 0) & 0xFFFF);
+        }
+        // --context N: identical instructions printed before the divergence, 8 by default.
+        else if ((arg == "--context") && (argIdx + 1 < argc))
+        {
+            contextSize = static_cast<uint32_t>(std::max(std::atoi(argv[++argIdx]), 0));
+        }
+        else
+        {
+            paths.push_back(argv[argIdx]);
+        }
+    }
+
+    if (paths.size() != 2)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s TRACE_A TRACE_B [--from ADDRESS] [--context N]\n"
+                     "Each trace is a ColorBoy binary trace or a gameboy-doctor log.\n"
+                     "Exit status: 0 if the traces match, 1 if they diverge, 2 on an error.\n",
+                     argv[0]);
+        return 2;
+    }
+
+    std::unique_ptr<TraceReader> readers[2];
+    for (uint32_t traceIdx = 0; traceIdx < 2; ++traceIdx)
+    {
+        std::string error;
+        readers[traceIdx] = TraceReader::open(paths[traceIdx], error);
+        if (readers[traceIdx] == nullptr)
+        {
+            std::fprintf(stderr, "%s: %s\n", paths[traceIdx], error.c_str());
+            return 2;
+        }
+    }
+    TraceReader& readerA = *readers[0];
+    TraceReader& readerB = *readers[1];
+
+    // The logs have no cycles, the binary traces are compared from their first instruction's.
+    const bool compareCycles = (readerA.hasCycles() == true) && (readerB.hasCycles() == true);
+
+    cputrace::Record recordA = {};
+    cputrace::Record recordB = {};
+    bool hasA = readFirst(readerA, fromAddress, recordA);
+    bool hasB = readFirst(readerB, fromAddress, recordB);
+    const uint32_t firstCycleA = recordA.cycle;
+    const uint32_t firstCycleB = recordB.cycle;
+
+    std::deque<cputrace::Record> context;
+    uint64_t index = 0;
+    while ((hasA == true) && (hasB == true))
+    {
+        const bool sameState = (recordA.pc == recordB.pc) && (recordA.sp == recordB.sp) &&
+                               (recordA.a == recordB.a) && (recordA.f == recordB.f) &&
+                               (recordA.b == recordB.b) && (recordA.c == recordB.c) &&
+                               (recordA.d == recordB.d) && (recordA.e == recordB.e) &&
+                               (recordA.h == recordB.h) && (recordA.l == recordB.l) &&
+                               (recordA.opcode == recordB.opcode);
+        const bool sameCycle = (compareCycles == false) ||
+                               (recordA.cycle - firstCycleA == recordB.cycle - firstCycleB);
+        if ((sameState == false) || (sameCycle == false))
+        {
+            break;
+        }
+
+        if (contextSize > 0)
+        {
+            if (context.size() == contextSize)
+            {
+                context.pop_front();
+            }
+            context.push_back(recordA);
+        }
+
+        ++index;
+        hasA = readerA.next(recordA);
+        hasB = readerB.next(recordB);
+    }
+
+    if ((reportError(paths[0], readerA) == true) || (reportError(paths[1], readerB) == true))
+    {
+        return 2;
+    }
+
+    if ((hasA == false) && (hasB == false))
+    {
+        std::printf("Traces match: %" PRIu64 " instructions\n", index);
+        return 0;
+    }
+
+    std::printf("First divergence at instruction %" PRIu64 "\n", index);
+    for (size_t contextIdx = 0; contextIdx < context.size(); ++contextIdx)
+    {
+        printRecord(" ", index - context.size() + contextIdx, context[contextIdx], compareCycles,
+                    firstCycleA);
+    }
+    if (hasA == true)
+    {
+        printRecord("A", index, recordA, compareCycles, firstCycleA);
+    }
+    else
+    {
+        std::printf("A ends\n");
+    }
+    if (hasB == true)
+    {
+        printRecord("B", index, recordB, compareCycles, firstCycleB);
+    }
+    else
+    {
+        std::printf("B ends\n");
+    }
+
+    return 1;
+}
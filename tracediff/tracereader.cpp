@@ -0,0 +1,336 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      tracereader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+// Local includes.
+#include "tracereader.h"
+
+#include <cstring>
+
+namespace
+{
+/// \brief Parse the hexadecimal number at pos, pos is moved past its digits.
+///
+/// \return false if there is no digit or more than 4.
+bool parseHex(const char*& pos, const char* const end, uint16_t& value)
+{
+    uint32_t number = 0;
+    const char* const start = pos;
+    for (; pos != end; ++pos)
+    {
+        const char digit = *pos;
+        if ((digit >= '0') && (digit <= '9'))
+        {
+            number = (number << 4) | (digit - '0');
+        }
+        else if ((digit >= 'A') && (digit <= 'F'))
+        {
+            number = (number << 4) | (digit - 'A' + 10);
+        }
+        else if ((digit >= 'a') && (digit <= 'f'))
+        {
+            number = (number << 4) | (digit - 'a' + 10);
+        }
+        else
+        {
+            break;
+        }
+    }
+    value = static_cast<uint16_t>(number);
+
+    return (pos != start) && (pos - start <= 4);
+}
+
+/// \brief Fields of a gameboy-doctor line, in the order of their bits in the parsed fields mask.
+enum DoctorField : uint32_t
+{
+    eDOCTORFIELD_a,
+    eDOCTORFIELD_f,
+    eDOCTORFIELD_b,
+    eDOCTORFIELD_c,
+    eDOCTORFIELD_d,
+    eDOCTORFIELD_e,
+    eDOCTORFIELD_h,
+    eDOCTORFIELD_l,
+    eDOCTORFIELD_sp,
+    eDOCTORFIELD_pc,
+    eDOCTORFIELD_pcmem,
+    eDOCTORFIELD_count
+};
+
+/// \brief Identify the key of a "KEY:VALUE" field, eDOCTORFIELD_count for an unknown key.
+DoctorField identifyField(const char* const key, const size_t length)
+{
+    if (length == 1)
+    {
+        switch (key[0])
+        {
+        case 'A': return eDOCTORFIELD_a;
+        case 'F': return eDOCTORFIELD_f;
+        case 'B': return eDOCTORFIELD_b;
+        case 'C': return eDOCTORFIELD_c;
+        case 'D': return eDOCTORFIELD_d;
+        case 'E': return eDOCTORFIELD_e;
+        case 'H': return eDOCTORFIELD_h;
+        case 'L': return eDOCTORFIELD_l;
+        default: return eDOCTORFIELD_count;
+        }
+    }
+    if ((length == 2) && (std::memcmp(key, "SP", 2) == 0))
+    {
+        return eDOCTORFIELD_sp;
+    }
+    if ((length == 2) && (std::memcmp(key, "PC", 2) == 0))
+    {
+        return eDOCTORFIELD_pc;
+    }
+    if ((length == 5) && (std::memcmp(key, "PCMEM", 5) == 0))
+    {
+        return eDOCTORFIELD_pcmem;
+    }
+
+    return eDOCTORFIELD_count;
+}
+
+/// \brief Parse a gameboy-doctor line, the unknown fields are skipped.
+///
+/// \return true if every known field was found, false otherwise.
+bool parseDoctorLine(const char* pos, const char* const end, cputrace::Record& record)
+{
+    uint32_t parsedFields = 0;
+    while (pos != end)
+    {
+        if (*pos == ' ')
+        {
+            ++pos;
+            continue;
+        }
+
+        const char* const key = pos;
+        while ((pos != end) && (*pos != ':') && (*pos != ' '))
+        {
+            ++pos;
+        }
+        if ((pos == end) || (*pos != ':'))
+        {
+            return false;
+        }
+        const DoctorField field = identifyField(key, pos - key);
+        ++pos;
+
+        uint16_t value = 0;
+        if (field == eDOCTORFIELD_count)
+        {
+            // Skip the unknown value.
+            while ((pos != end) && (*pos != ' '))
+            {
+                ++pos;
+            }
+            continue;
+        }
+        if (parseHex(pos, end, value) == false)
+        {
+            return false;
+        }
+
+        switch (field)
+        {
+        case eDOCTORFIELD_a: record.a = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_f: record.f = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_b: record.b = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_c: record.c = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_d: record.d = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_e: record.e = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_h: record.h = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_l: record.l = static_cast<uint8_t>(value); break;
+        case eDOCTORFIELD_sp: record.sp = value; break;
+        case eDOCTORFIELD_pc: record.pc = value; break;
+        default:
+            // Only the opcode of PCMEM's bytes is compared.
+            record.opcode = static_cast<uint8_t>(value);
+            while ((pos != end) && (*pos != ' '))
+            {
+                ++pos;
+            }
+            break;
+        }
+        parsedFields |= 1u << field;
+    }
+
+    return parsedFields == (1u << eDOCTORFIELD_count) - 1;
+}
+
+}  // namespace
+
+TraceReader::TraceReader(FILE* file) : m_file(file) {}
+
+// =================================================================================================
+
+TraceReader::~TraceReader() { std::fclose(m_file); }
+
+// =================================================================================================
+
+std::unique_ptr<TraceReader> TraceReader::open(const std::filesystem::path& path,
+                                               std::string& error)
+{
+    FILE* const file = std::fopen(path.string().c_str(), "rb");
+    if (file == nullptr)
+    {
+        error = "cannot open the file";
+        return nullptr;
+    }
+
+    cputrace::FileHeader header = {};
+    if ((std::fread(&header, sizeof(header), 1, file) == 1) && (header.magic == cputrace::eMagic))
+    {
+        if ((header.version != cputrace::eVersion) ||
+            (header.recordSize != cputrace::eEncodedRecordSize))
+        {
+            std::fclose(file);
+            error = "unsupported trace version " + std::to_string(header.version);
+            return nullptr;
+        }
+
+        return std::make_unique<BinaryTraceReader>(file);
+    }
+
+    // Not a binary trace: a text log from its start.
+    std::rewind(file);
+
+    return std::make_unique<DoctorLogReader>(file);
+}
+
+// =================================================================================================
+
+bool BinaryTraceReader::next(cputrace::Record& record)
+{
+    if ((m_nextRecord == m_records.size()) && (readBlock() == false))
+    {
+        return false;
+    }
+
+    record = m_records[m_nextRecord++];
+
+    return true;
+}
+
+// =================================================================================================
+
+bool BinaryTraceReader::readBlock()
+{
+    cputrace::BlockHeader header;
+    if (std::fread(&header, sizeof(header), 1, m_file) != 1)
+    {
+        if (std::feof(m_file) == 0)
+        {
+            m_error = "cannot read the trace";
+        }
+        return false;
+    }
+
+    m_compressed.resize(header.compressedSize);
+    if ((std::fread(m_compressed.data(), 1, m_compressed.size(), m_file) != m_compressed.size()) ||
+        (cputrace::decodeBlock(header, m_compressed.data(), m_records) == false))
+    {
+        m_error = "truncated or corrupted block";
+        return false;
+    }
+    m_nextRecord = 0;
+
+    return true;
+}
+
+// =================================================================================================
+
+bool DoctorLogReader::next(cputrace::Record& record)
+{
+    const char* end = nullptr;
+    const char* const line = nextLine(end);
+    if (line == nullptr)
+    {
+        return false;
+    }
+
+    record = {};
+    if (parseDoctorLine(line, end, record) == false)
+    {
+        m_error = "line " + std::to_string(m_lineNumber) + ": not a gameboy-doctor line";
+        return false;
+    }
+
+    return true;
+}
+
+// =================================================================================================
+
+const char* DoctorLogReader::nextLine(const char*& end)
+{
+    while (true)
+    {
+        char* const begin = m_buffer.data() + m_begin;
+        char* const newLine = static_cast<char*>(std::memchr(begin, '\n', m_end - m_begin));
+
+        // The last line may have no line feed.
+        const bool endOfFile = (newLine == nullptr) && (m_begin == 0) && (m_end != 0) &&
+                               (m_end < m_buffer.size()) && (std::feof(m_file) != 0);
+        if ((newLine != nullptr) || (endOfFile == true))
+        {
+            end = (newLine != nullptr) ? newLine : m_buffer.data() + m_end;
+            m_begin = (newLine != nullptr) ? (newLine + 1 - m_buffer.data()) : m_end;
+            ++m_lineNumber;
+
+            if ((end != begin) && (end[-1] == '\r'))
+            {
+                --end;
+            }
+            if (end != begin)
+            {
+                return begin;
+            }
+            continue;
+        }
+
+        // Move the partial line to the front and read more.
+        std::memmove(m_buffer.data(), begin, m_end - m_begin);
+        m_end -= m_begin;
+        m_begin = 0;
+        if (m_end == m_buffer.size())
+        {
+            m_error = "line " + std::to_string(m_lineNumber + 1) + ": too long";
+            return nullptr;
+        }
+
+        const size_t readSize = std::fread(m_buffer.data() + m_end, 1, m_buffer.size() - m_end,
+                                           m_file);
+        if (std::ferror(m_file) != 0)
+        {
+            m_error = "cannot read the log";
+            return nullptr;
+        }
+        if ((readSize == 0) && (m_end == 0))
+        {
+            return nullptr;
+        }
+        m_end += readSize;
+    }
+}
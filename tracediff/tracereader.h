@@ -0,0 +1,123 @@
+/// Copyright (c) 2018 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+/// \file      tracereader.h
+///
+/// \brief     Readers of the ColorBoy binary CPU traces and of the reference emulators' logs.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef TRACEREADER_H_
+#define TRACEREADER_H_
+
+#include "cputrace.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// \brief Sequential reader of the instructions of a trace.
+class TraceReader
+{
+public:
+    virtual ~TraceReader();
+
+    /// \brief Open a trace, binary (cputrace.h) or text log, recognized by its first bytes.
+    ///
+    /// The text logs are in the gameboy-doctor format, one instruction per line:
+    ///   A:01 F:B0 B:00 C:13 D:00 E:D8 H:01 L:4D SP:FFFE PC:0100 PCMEM:00,C3,13,02
+    ///
+    /// \param path trace file path.
+    /// \param[out] error receives the reason of a failure.
+    ///
+    /// \return the reader, nullptr if the file cannot be read.
+    static std::unique_ptr<TraceReader> open(const std::filesystem::path& path,
+                                             std::string& error);
+
+    /// \brief Read the next instruction.
+    ///
+    /// \param[out] record receives the instruction, its cycle is 0 if the trace has no cycles.
+    ///
+    /// \return true if an instruction was read, false at the end of the trace or on an error.
+    virtual bool next(cputrace::Record& record) = 0;
+
+    /// \brief Does the trace record the cycle of the instructions?
+    virtual bool hasCycles() const = 0;
+
+    /// \brief Get the reason why next() stopped early, empty at the end of a valid trace.
+    const std::string& getError() const { return m_error; }
+
+protected:
+    /// \brief Constructor.
+    ///
+    /// \param file the opened trace file, closed by the reader.
+    explicit TraceReader(FILE* file);
+
+    FILE* m_file;         ///< Trace file.
+    std::string m_error;  ///< Reason of an early stop.
+};
+
+/// \brief Reader of a cputrace file, decoding one block at a time.
+class BinaryTraceReader : public TraceReader
+{
+public:
+    explicit BinaryTraceReader(FILE* file) : TraceReader(file) {}
+
+    bool next(cputrace::Record& record) override;
+    bool hasCycles() const override { return true; }
+
+private:
+    /// \brief Read and decode the next block.
+    bool readBlock();
+
+    std::vector<uint8_t> m_compressed;       ///< Compressed records of the current block.
+    std::vector<cputrace::Record> m_records;  ///< Records of the current block.
+    size_t m_nextRecord = 0;                  ///< Next record of the block to return.
+};
+
+/// \brief Reader of a gameboy-doctor text log.
+class DoctorLogReader : public TraceReader
+{
+public:
+    explicit DoctorLogReader(FILE* file) : TraceReader(file), m_buffer(eBufferSize) {}
+
+    bool next(cputrace::Record& record) override;
+    bool hasCycles() const override { return false; }
+
+private:
+    enum : size_t
+    {
+        eBufferSize = 1 << 20  ///< Bytes read from the file at once.
+    };
+
+    /// \brief Get the next non-empty line, nullptr at the end of the file.
+    ///
+    /// \param[out] end receives the end of the line.
+    const char* nextLine(const char*& end);
+
+    std::vector<char> m_buffer;  ///< Bytes read from the file.
+    size_t m_begin = 0;          ///< Start of the unread bytes in the buffer.
+    size_t m_end = 0;            ///< End of the bytes in the buffer.
+    uint64_t m_lineNumber = 0;   ///< Number of the last line read.
+};
+
+#endif /* TRACEREADER_H_ */